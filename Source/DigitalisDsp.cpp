@@ -0,0 +1,187 @@
+#include "DigitalisDsp.h"
+#include "DigitalisEngines.h"
+
+namespace digitalis::dsp
+{
+namespace
+{
+using EngineFactory = std::unique_ptr<juce::AudioProcessor> (*)();
+
+// In EngineId order.
+constexpr EngineFactory engineFactories[] = {
+    detail::createEngine<1>, detail::createEngine<2>, detail::createEngine<3>, detail::createEngine<4>,
+    detail::createEngine<5>, detail::createEngine<6>, detail::createEngine<7>, detail::createEngine<8>,
+    detail::createEngine<9>, detail::createEngine<10>, detail::createEngine<11>
+};
+} // namespace
+
+struct Engine::Impl
+{
+    std::unique_ptr<juce::AudioProcessor> processor;
+    std::vector<juce::RangedAudioParameter*> parameters;
+    std::vector<ParameterInfo> parameterInfo;
+    std::string name;
+    juce::MidiBuffer midi;
+    int maxBlockSize = 0;
+    int numChannels = 0;
+};
+
+std::unique_ptr<Engine> Engine::create(EngineId id)
+{
+    const auto index = static_cast<int>(id) - 1;
+    if (! juce::isPositiveAndBelow(index, (int) std::size(engineFactories)))
+        return nullptr;
+
+    auto impl = std::make_unique<Impl>();
+    impl->processor = engineFactories[index]();
+    impl->name = impl->processor->getName().toStdString();
+
+    for (auto* parameter : impl->processor->getParameters())
+    {
+        auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(parameter);
+        jassert(ranged != nullptr); // every engine parameter lives in the value tree state
+
+        const auto& range = ranged->getNormalisableRange();
+        impl->parameters.push_back(ranged);
+        impl->parameterInfo.push_back({ ranged->paramID.toStdString(),
+                                        ranged->getName(256).toStdString(),
+                                        range.start,
+                                        range.end,
+                                        ranged->convertFrom0to1(ranged->getDefaultValue()) });
+    }
+
+    return std::unique_ptr<Engine>(new Engine(std::move(impl)));
+}
+
+Engine::Engine(std::unique_ptr<Impl> state) : impl(std::move(state)) {}
+
+Engine::~Engine() = default;
+
+const std::string& Engine::getName() const noexcept
+{
+    return impl->name;
+}
+
+bool Engine::prepare(double sampleRate, int maxBlockSize, int numChannels)
+{
+    if (sampleRate <= 0.0 || maxBlockSize < 1 || numChannels < 1 || numChannels > 2)
+        return false;
+
+    impl->processor->setPlayConfigDetails(numChannels, numChannels, sampleRate, maxBlockSize);
+    impl->processor->prepareToPlay(sampleRate, maxBlockSize);
+    impl->maxBlockSize = maxBlockSize;
+    impl->numChannels = numChannels;
+    return true;
+}
+
+void Engine::reset()
+{
+    impl->processor->reset();
+}
+
+void Engine::setNonRealtime(bool isNonRealtime)
+{
+    impl->processor->setNonRealtime(isNonRealtime);
+}
+
+int Engine::getNumParameters() const noexcept
+{
+    return (int) impl->parameters.size();
+}
+
+const ParameterInfo& Engine::getParameterInfo(int index) const
+{
+    jassert(juce::isPositiveAndBelow(index, getNumParameters()));
+    return impl->parameterInfo[(size_t) index];
+}
+
+int Engine::findParameter(std::string_view id) const noexcept
+{
+    for (size_t i = 0; i < impl->parameterInfo.size(); ++i)
+        if (impl->parameterInfo[i].id == id)
+            return (int) i;
+    return -1;
+}
+
+float Engine::getParameter(int index) const noexcept
+{
+    if (! juce::isPositiveAndBelow(index, getNumParameters()))
+        return 0.0f;
+
+    const auto* parameter = impl->parameters[(size_t) index];
+    return parameter->convertFrom0to1(parameter->getValue());
+}
+
+void Engine::setParameter(int index, float value) noexcept
+{
+    if (! juce::isPositiveAndBelow(index, getNumParameters()))
+        return;
+
+    // Through the same path as host automation, so the engine's cached parameter values follow.
+    auto* parameter = impl->parameters[(size_t) index];
+    parameter->setValueNotifyingHost(parameter->convertTo0to1(value));
+}
+
+int Engine::getNumPresets()
+{
+    return impl->processor->getNumPrograms();
+}
+
+std::string Engine::getPresetName(int index)
+{
+    return impl->processor->getProgramName(index).toStdString();
+}
+
+void Engine::loadPreset(int index)
+{
+    impl->processor->setCurrentProgram(index);
+}
+
+std::vector<std::byte> Engine::saveState()
+{
+    juce::MemoryBlock block;
+    impl->processor->getStateInformation(block);
+
+    const auto* begin = static_cast<const std::byte*>(block.getData());
+    return { begin, begin + block.getSize() };
+}
+
+void Engine::loadState(const void* data, std::size_t size)
+{
+    impl->processor->setStateInformation(data, (int) size);
+}
+
+int Engine::getLatencySamples() const noexcept
+{
+    return impl->processor->getLatencySamples();
+}
+
+double Engine::getTailSeconds() const
+{
+    return impl->processor->getTailLengthSeconds();
+}
+
+void Engine::process(float* const* channels, int numChannels, int numSamples) noexcept
+{
+    auto& state = *impl;
+    if (state.maxBlockSize == 0)
+        return;
+
+    jassert(numChannels >= state.numChannels);
+    if (numChannels < state.numChannels)
+        return;
+
+    // The buffer refers to the caller's memory; up to 32 channels it keeps the pointers inline.
+    float* chunk[2] {};
+
+    for (int offset = 0; offset < numSamples; offset += state.maxBlockSize)
+    {
+        const auto length = juce::jmin(state.maxBlockSize, numSamples - offset);
+        for (int ch = 0; ch < state.numChannels; ++ch)
+            chunk[ch] = channels[ch] + offset;
+
+        juce::AudioBuffer<float> buffer(chunk, state.numChannels, length);
+        state.processor->processBlock(buffer, state.midi);
+    }
+}
+} // namespace digitalis::dsp
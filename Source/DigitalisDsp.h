@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// The Digitalis engines behind a plain C++ interface, for hosts that run the DSP directly rather
+// than loading a plugin: no JUCE types, no plugin wrapper, no host callbacks. Link digitalis_dsp
+// and include this header. Every engine runs the same code as its plugin, so renders match.
+//
+// Threading follows the plugin contract. create, prepare, presets and state belong to one
+// non-realtime thread; process belongs to the audio thread and neither allocates nor locks;
+// setParameter may be called from either, and takes effect from the next process call.
+namespace digitalis::dsp
+{
+enum class EngineId
+{
+    floatingPointCollapse = 1,
+    nyquistDestroyer,
+    bufferGlitchEngine,
+    automationQuantiser,
+    streamingArtifactGenerator,
+    fftBrutalist,
+    overclockFailure,
+    deterministicMachine,
+    classicBufferStutter,
+    melodicSkippingEngine,
+    chain
+};
+
+struct ParameterInfo
+{
+    std::string id;   // as stored in plugin state and named in presets
+    std::string name; // for display
+    float minValue = 0.0f;
+    float maxValue = 1.0f;
+    float defaultValue = 0.0f;
+};
+
+class Engine
+{
+public:
+    // A new engine at its parameter defaults, or nullptr if id names no engine.
+    static std::unique_ptr<Engine> create(EngineId id);
+
+    ~Engine();
+
+    Engine(const Engine&) = delete;
+    Engine& operator=(const Engine&) = delete;
+
+    const std::string& getName() const noexcept;
+
+    // Allocates everything process needs for blocks of up to maxBlockSize samples. numChannels is
+    // 1 or 2; returns false, and changes nothing, for anything else.
+    bool prepare(double sampleRate, int maxBlockSize, int numChannels);
+    void reset();
+
+    // Offline renders may spread channels across helper threads; realtime processing never does.
+    void setNonRealtime(bool isNonRealtime);
+
+    // Parameters are addressed by a stable index into the engine's list. Values are in the
+    // parameter's own units (choices and switches count from 0) and are clamped to its range.
+    int getNumParameters() const noexcept;
+    const ParameterInfo& getParameterInfo(int index) const;
+    int findParameter(std::string_view id) const noexcept; // -1 if the engine has no such parameter
+    float getParameter(int index) const noexcept;
+    void setParameter(int index, float value) noexcept;
+
+    int getNumPresets();
+    std::string getPresetName(int index);
+    void loadPreset(int index);
+
+    // The same binary state the plugin saves, so sessions move between the two.
+    std::vector<std::byte> saveState();
+    void loadState(const void* data, std::size_t size);
+
+    int getLatencySamples() const noexcept;
+    double getTailSeconds() const;
+
+    // Processes in place. numChannels must be at least the prepared count; channels beyond it are
+    // left untouched. Blocks longer than maxBlockSize are split. Does nothing before prepare.
+    void process(float* const* channels, int numChannels, int numSamples) noexcept;
+
+private:
+    struct Impl;
+    explicit Engine(std::unique_ptr<Impl>);
+
+    std::unique_ptr<Impl> impl;
+};
+} // namespace digitalis::dsp
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <memory>
+
+namespace digitalis::dsp::detail
+{
+// Creates the processor for one engine index. Each specialisation is defined by the copy of
+// PluginProcessor.cpp that digitalis_dsp compiles for that index.
+template <int EngineIndex>
+std::unique_ptr<juce::AudioProcessor> createEngine();
+} // namespace digitalis::dsp::detail
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+// Sample-level primitives shared by the engines and the kernel benchmark. They are free functions
+// with no processor state, so Tools/KernelBenchMain.cpp times exactly the code the plugins run.
+namespace digitalis
+{
+inline float quantise(float x, float steps)
+{
+    return std::round(x * steps) / steps;
+}
+
+inline float truncateMantissa(float x, int keepBits)
+{
+    if (keepBits >= 23 || !std::isfinite(x) || x == 0.0f)
+        return x;
+
+    const auto bits = std::bit_cast<std::uint32_t>(x);
+    const auto exponent = (bits >> 23u) & 0xffu;
+    if (exponent == 0u || exponent == 0xffu)
+        return x;
+
+    const auto dropBits = static_cast<std::uint32_t>(23 - juce::jlimit(1, 23, keepBits));
+    const auto mask = ~((1u << dropBits) - 1u);
+    const auto signAndExponent = bits & 0xff800000u;
+    const auto mantissa = bits & 0x007fffffu;
+    return std::bit_cast<float>(signAndExponent | (mantissa & mask));
+}
+
+inline float quantiseExponent(float x, int exponentStep)
+{
+    if (exponentStep <= 1 || !std::isfinite(x) || x == 0.0f)
+        return x;
+
+    const auto bits = std::bit_cast<std::uint32_t>(x);
+    const auto exponent = (bits >> 23u) & 0xffu;
+    if (exponent == 0u || exponent == 0xffu)
+        return x;
+
+    const auto unbiased = static_cast<int>(exponent) - 127;
+    const auto q = static_cast<int>(std::round(static_cast<float>(unbiased) / static_cast<float>(exponentStep))) * exponentStep;
+    const auto clamped = juce::jlimit(-126, 127, q);
+    const auto newExponent = static_cast<std::uint32_t>(clamped + 127);
+
+    const auto signAndMantissa = bits & 0x807fffffu;
+    return std::bit_cast<float>(signAndMantissa | (newExponent << 23u));
+}
+
+// Replaces NaN and +-Inf with 0, testing the exponent bits so the loop vectorises and still works
+// under -ffinite-math-only. Returns whether anything was replaced.
+inline bool flushNonFinite(float* data, int numSamples)
+{
+    auto found = 0u;
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto nonFinite = (std::bit_cast<std::uint32_t>(data[i]) & 0x7f800000u) == 0x7f800000u;
+        found |= nonFinite ? 1u : 0u;
+        data[i] = nonFinite ? 0.0f : data[i];
+    }
+
+    return found != 0u;
+}
+
+// Peak follower with separate attack and release coefficients: the share of the old envelope kept
+// is 1 - attack while x rises above it and release while it falls.
+inline float followEnvelope(float env, float x, float attack, float release)
+{
+    return x > env ? (attack * x + (1.0f - attack) * env)
+                   : (release * env + (1.0f - release) * x);
+}
+
+// Multi-lane FNV-1a over 16-bit quantised samples. Sample n of a hash window goes to lane n % Lanes,
+// so the lanes are independent chains the compiler can run side by side; they are only folded
+// together when a window closes. Rounding is written out (half away from zero, as std::round) so
+// the quantiser vectorises too.
+template <size_t Lanes>
+void hashSamples(std::array<std::uint32_t, Lanes>& lanes, int windowPos, const float* x, int count)
+{
+    constexpr auto prime = 16777619u;
+    const auto quantiseForHash = [](float v)
+    {
+        v = juce::jlimit(-1.0f, 1.0f, v) * 32767.0f;
+        return static_cast<std::uint32_t>(static_cast<std::int32_t>(v + std::copysign(0.5f, v)));
+    };
+
+    auto i = 0;
+    for (; i < count && (windowPos + i) % (int) Lanes != 0; ++i)
+    {
+        auto& lane = lanes[(size_t) ((windowPos + i) % (int) Lanes)];
+        lane = (lane ^ quantiseForHash(x[i])) * prime;
+    }
+
+    for (; i + (int) Lanes <= count; i += (int) Lanes)
+        for (size_t l = 0; l < Lanes; ++l)
+            lanes[l] = (lanes[l] ^ quantiseForHash(x[i + (int) l])) * prime;
+
+    for (; i < count; ++i)
+    {
+        auto& lane = lanes[(size_t) ((windowPos + i) % (int) Lanes)];
+        lane = (lane ^ quantiseForHash(x[i])) * prime;
+    }
+}
+
+template <size_t Lanes>
+std::uint32_t foldHashLanes(const std::array<std::uint32_t, Lanes>& lanes)
+{
+    auto hash = 2166136261u;
+    for (const auto lane : lanes)
+        hash = (hash ^ lane) * 16777619u;
+    return hash;
+}
+
+template <size_t Lanes>
+void seedHashLanes(std::array<std::uint32_t, Lanes>& lanes, std::uint32_t seed)
+{
+    for (size_t l = 0; l < Lanes; ++l)
+        lanes[l] = (seed ^ static_cast<std::uint32_t>(l)) * 16777619u;
+}
+} // namespace digitalis
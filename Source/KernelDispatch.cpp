@@ -0,0 +1,279 @@
+#include "KernelDispatch.h"
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__linux__)
+ #include <asm/hwcap.h>
+ #include <sys/auxv.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+ #define DIGITALIS_X86_VARIANTS 1
+#else
+ #define DIGITALIS_X86_VARIANTS 0
+#endif
+
+// This file is compiled with -ffp-contract=off, so no variant fuses a multiply and an add that
+// the others round separately, and with -fno-trapping-math, without which the selects in these
+// loops are not turned into blends and the loops stay scalar.
+namespace digitalis
+{
+namespace
+{
+// The kernel bodies. Each variant below is a set of thin functions compiled for one instruction
+// set; these are forced inline into them, so the loops are vectorised for that set. They are
+// written without branches or library calls in the loop so the compiler can do that.
+
+forcedinline float clampTo(float lo, float hi, float x) noexcept
+{
+    return x < lo ? lo : (hi < x ? hi : x); // as juce::jlimit
+}
+
+// std::round (halfway cases away from zero, sign of zero kept), in a form that vectorises: trunc
+// maps to a single instruction from SSE4.1 and NEON on, and v - trunc(v) is exact.
+forcedinline float roundHalfAway(float v) noexcept
+{
+    const auto t = std::trunc(v);
+    return t + std::copysign(std::abs(v - t) >= 0.5f ? 1.0f : 0.0f, v);
+}
+
+forcedinline std::uint32_t toBits(float x) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+forcedinline float fromBits(std::uint32_t bits) noexcept
+{
+    float x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+forcedinline float sumOfSquaresBody(const float* data, int numSamples) noexcept
+{
+    // Sixteen independent partial sums fill one AVX-512 register or four narrower ones.
+    constexpr int lanes = 16;
+    float partial[lanes] {};
+
+    auto i = 0;
+    for (; i + lanes <= numSamples; i += lanes)
+        for (int l = 0; l < lanes; ++l)
+            partial[l] += data[i + l] * data[i + l];
+
+    auto sum = 0.0f;
+    for (const auto p : partial)
+        sum += p;
+    for (; i < numSamples; ++i)
+        sum += data[i] * data[i];
+    return sum;
+}
+
+forcedinline void saturateDraftBody(float* data, int numSamples) noexcept
+{
+    // juce::dsp::FastMathApproximations::tanh on [-5, 5], clamped to +-1, as saturate() does.
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto x = clampTo(-5.0f, 5.0f, data[i]);
+        const auto x2 = x * x;
+        const auto numerator = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+        const auto denominator = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + 28.0f * x2));
+        data[i] = clampTo(-1.0f, 1.0f, numerator / denominator);
+    }
+}
+
+forcedinline void quantiseBody(float* data, int numSamples, float steps) noexcept
+{
+    for (int i = 0; i < numSamples; ++i)
+        data[i] = roundHalfAway(data[i] * steps) / steps;
+}
+
+// Zeros, subnormals, infinities and NaN have an exponent field of 0 or 255 and pass through, as in
+// the scalar truncateMantissa and quantiseExponent.
+forcedinline void truncateMantissaBody(float* data, int numSamples, int keepBits) noexcept
+{
+    if (keepBits >= 23)
+        return;
+
+    const auto dropBits = static_cast<std::uint32_t>(23 - juce::jlimit(1, 23, keepBits));
+    const auto mask = ~((1u << dropBits) - 1u);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto bits = toBits(data[i]);
+        const auto exponent = (bits >> 23u) & 0xffu;
+        data[i] = fromBits(exponent == 0u || exponent == 0xffu ? bits : (bits & mask));
+    }
+}
+
+forcedinline void quantiseExponentBody(float* data, int numSamples, int exponentStep) noexcept
+{
+    if (exponentStep <= 1)
+        return;
+
+    // Rounding the float quotient is exact here: |exponent| <= 127 and the step is an integer, so a
+    // quotient is either a tie or at least 1 / (2 * step) away from one.
+    const auto step = static_cast<float>(exponentStep);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto bits = toBits(data[i]);
+        const auto exponent = static_cast<std::int32_t>((bits >> 23u) & 0xffu);
+        const auto q = static_cast<std::int32_t>(roundHalfAway(static_cast<float>(exponent - 127) / step)) * exponentStep;
+        const auto clamped = q < -126 ? -126 : (q > 127 ? 127 : q);
+        const auto rebuilt = (bits & 0x807fffffu) | (static_cast<std::uint32_t>(clamped + 127) << 23u);
+        data[i] = fromBits(exponent == 0 || exponent == 0xff ? bits : rebuilt);
+    }
+}
+
+forcedinline void packHistoryBody(const float* source, std::int16_t* dest, int numSamples, float toFixed) noexcept
+{
+    // Converting a float outside the int16 range, or NaN, is undefined, so NaN and Inf are stored
+    // as 0 and everything else is clamped to full scale before the cast. The test is on the
+    // exponent bits, as in digitalis::flushNonFinite, so -ffinite-math-only can't fold it away.
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto scaled = source[i] * toFixed;
+        const auto finite = (toBits(scaled) & 0x7f800000u) == 0x7f800000u ? 0.0f : scaled;
+        dest[i] = static_cast<std::int16_t>(clampTo(-32767.0f, 32767.0f, finite + std::copysign(0.5f, finite)));
+    }
+}
+
+forcedinline void unpackHistoryBody(const std::int16_t* source, float* dest, int numSamples, float scale) noexcept
+{
+    for (int i = 0; i < numSamples; ++i)
+        dest[i] = static_cast<float>(source[i]) * scale;
+}
+
+#define DIGITALIS_KERNEL_VARIANT(variant, attributes)                                                            \
+    namespace variant                                                                                           \
+    {                                                                                                           \
+    attributes float sumOfSquares(const float* d, int n) { return sumOfSquaresBody(d, n); }                     \
+    attributes void saturateDraft(float* d, int n) { saturateDraftBody(d, n); }                                 \
+    attributes void quantise(float* d, int n, float s) { quantiseBody(d, n, s); }                               \
+    attributes void truncateMantissa(float* d, int n, int b) { truncateMantissaBody(d, n, b); }                 \
+    attributes void quantiseExponent(float* d, int n, int s) { quantiseExponentBody(d, n, s); }                 \
+    attributes void packHistory(const float* s, std::int16_t* d, int n, float k) { packHistoryBody(s, d, n, k); } \
+    attributes void unpackHistory(const std::int16_t* s, float* d, int n, float k) { unpackHistoryBody(s, d, n, k); } \
+    }
+
+#define DIGITALIS_KERNEL_TABLE(variant, label)                                                                   \
+    KernelTable { label, variant::sumOfSquares, variant::saturateDraft, variant::quantise,                      \
+                  variant::truncateMantissa, variant::quantiseExponent, variant::packHistory,                   \
+                  variant::unpackHistory }
+
+// The baseline is whatever the target is built for: SSE2 on x86-64, NEON on aarch64 (where it is
+// part of the base architecture, so there is nothing wider to dispatch to without SVE).
+DIGITALIS_KERNEL_VARIANT(baseline, )
+
+#if DIGITALIS_X86_VARIANTS
+DIGITALIS_KERNEL_VARIANT(sse41, __attribute__((target("sse4.1"))))
+DIGITALIS_KERNEL_VARIANT(avx2, __attribute__((target("avx2"))))
+DIGITALIS_KERNEL_VARIANT(avx512, __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl"))))
+#endif
+
+#undef DIGITALIS_KERNEL_VARIANT
+
+constexpr const char* baselineName()
+{
+   #if DIGITALIS_X86_VARIANTS
+    return "sse2";
+   #elif defined(__aarch64__) || defined(__ARM_NEON)
+    return "neon";
+   #else
+    return "generic";
+   #endif
+}
+
+constexpr KernelTable baselineTable = DIGITALIS_KERNEL_TABLE(baseline, baselineName());
+#if DIGITALIS_X86_VARIANTS
+constexpr KernelTable sse41Table = DIGITALIS_KERNEL_TABLE(sse41, "sse4.1");
+constexpr KernelTable avx2Table = DIGITALIS_KERNEL_TABLE(avx2, "avx2");
+constexpr KernelTable avx512Table = DIGITALIS_KERNEL_TABLE(avx512, "avx512");
+#endif
+
+#undef DIGITALIS_KERNEL_TABLE
+
+struct Variants
+{
+    Variants()
+    {
+        tables[count++] = &baselineTable;
+
+       #if DIGITALIS_X86_VARIANTS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse4.1"))
+            tables[count++] = &sse41Table;
+        if (__builtin_cpu_supports("avx2"))
+            tables[count++] = &avx2Table;
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+            && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+            tables[count++] = &avx512Table;
+       #elif defined(__aarch64__) && defined(__linux__)
+        // NEON is mandatory on aarch64; the check only guards against a kernel that hides it.
+        if ((getauxval(AT_HWCAP) & HWCAP_ASIMD) == 0)
+            count = 1;
+       #endif
+    }
+
+    const KernelTable* tables[4] {};
+    int count = 0;
+};
+
+const Variants& variants()
+{
+    static const Variants v;
+    return v;
+}
+
+const KernelTable* findVariant(const juce::String& name)
+{
+    for (int i = 0; i < variants().count; ++i)
+        if (name.equalsIgnoreCase(variants().tables[i]->name))
+            return variants().tables[i];
+    return nullptr;
+}
+
+std::atomic<const KernelTable*> selected { nullptr };
+
+const KernelTable* selectVariant()
+{
+    if (const auto* forced = std::getenv("DIGITALIS_FORCE_ISA"))
+        if (const auto* table = findVariant(forced))
+            return table;
+
+    return variants().tables[variants().count - 1];
+}
+} // namespace
+
+const KernelTable& kernels() noexcept
+{
+    auto* table = selected.load(std::memory_order_acquire);
+    if (table == nullptr)
+    {
+        const KernelTable* expected = nullptr;
+        table = selectVariant();
+        if (! selected.compare_exchange_strong(expected, table, std::memory_order_acq_rel))
+            table = expected;
+    }
+    return *table;
+}
+
+std::span<const KernelTable* const> availableKernels()
+{
+    return { variants().tables, (size_t) variants().count };
+}
+
+bool forceKernels(const juce::String& name)
+{
+    if (const auto* table = findVariant(name))
+    {
+        selected.store(table, std::memory_order_release);
+        return true;
+    }
+    return false;
+}
+} // namespace digitalis
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <cstdint>
+#include <span>
+
+namespace digitalis
+{
+// Block forms of the hot per-sample kernels, compiled once per instruction set. The variant for
+// the running CPU is picked on first use (cpuid on x86-64, HWCAP on aarch64 Linux) and stays for
+// the life of the process. Every variant gives bit-identical results except sumOfSquares, whose
+// partial sums are added in a different order.
+struct KernelTable
+{
+    const char* name;
+
+    float (*sumOfSquares)(const float* data, int numSamples);
+    void (*saturateDraft)(float* data, int numSamples); // the draft-tier saturate(), in place
+    void (*quantise)(float* data, int numSamples, float steps);
+    void (*truncateMantissa)(float* data, int numSamples, int keepBits);
+    void (*quantiseExponent)(float* data, int numSamples, int exponentStep);
+    void (*packHistory)(const float* source, std::int16_t* dest, int numSamples, float toFixed);
+    void (*unpackHistory)(const std::int16_t* source, float* dest, int numSamples, float scale);
+};
+
+// The selected table. DIGITALIS_FORCE_ISA in the environment overrides the choice, if the named
+// variant can run here.
+const KernelTable& kernels() noexcept;
+
+// Every variant this CPU can run, baseline first.
+std::span<const KernelTable* const> availableKernels();
+
+// Switches to the named variant for the rest of the process; false if it is unknown or cannot run
+// here. For the benchmark and tests, before any audio runs.
+bool forceKernels(const juce::String& name);
+} // namespace digitalis
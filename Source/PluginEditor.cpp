@@ -33,6 +33,21 @@ public:
     {
     }
 
+    // Knob faces never change, so the editor renders them into its background layer with this and
+    // drawRotarySlider only adds the moving parts on top.
+    void drawRotaryFace(juce::Graphics& g, juce::Rectangle<int> sliderBounds) const
+    {
+        const auto area = getKnobArea(sliderBounds);
+
+        g.setColour(theme.panel.brighter(0.2f));
+        g.fillEllipse(area);
+
+        g.setColour(theme.bgBottom.withAlpha(0.9f));
+        g.drawEllipse(area, 1.5f);
+    }
+
+    // The value arc is one tinted frame of a pre-rendered strip and the cap is a cached mask, so a
+    // repaint strokes nothing and builds no paths.
     void drawRotarySlider(juce::Graphics& g,
                           int x,
                           int y,
@@ -45,30 +60,30 @@ public:
     {
         juce::ignoreUnused(slider);
 
-        auto area = juce::Rectangle<float>((float) x, (float) y, (float) width, (float) height).reduced(6.0f);
+        const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const auto& art = knobArt->get({ width, height }, scale, rotaryStartAngle, rotaryEndAngle);
+
+        const auto area = getKnobArea({ x, y, width, height });
         const auto radius = juce::jmin(area.getWidth(), area.getHeight()) * 0.5f;
         const auto centre = area.getCentre();
         const auto angle = juce::jmap(sliderPosProportional, rotaryStartAngle, rotaryEndAngle);
 
-        g.setColour(theme.panel.brighter(0.2f));
-        g.fillEllipse(area);
-
-        g.setColour(theme.bgBottom.withAlpha(0.9f));
-        g.drawEllipse(area, 1.5f);
-
-        juce::Path arc;
-        arc.addCentredArc(centre.x, centre.y, radius - 6.0f, radius - 6.0f, 0.0f, rotaryStartAngle, angle, true);
+        const auto frame = juce::jlimit(0, KnobArt::numFrames - 1, juce::roundToInt(sliderPosProportional * (float) (KnobArt::numFrames - 1)));
+        const auto framePixels = art.arcStrip.getHeight();
+        const auto arcBounds = art.arcBounds + juce::Point<int>(x, y);
         g.setColour(theme.accent);
-        g.strokePath(arc, juce::PathStrokeType(4.0f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+        g.drawImage(art.arcStrip, arcBounds.getX(), arcBounds.getY(), arcBounds.getWidth(), arcBounds.getHeight(),
+                    frame * framePixels, 0, framePixels, framePixels, true);
 
-        juce::Path notch;
-        notch.addRectangle(-1.6f, -radius + 10.0f, 3.2f, radius * 0.48f);
-        notch.applyTransform(juce::AffineTransform::rotation(angle).translated(centre.x, centre.y));
-        g.setColour(theme.text);
-        g.fillPath(notch);
+        {
+            juce::Graphics::ScopedSaveState notchState(g);
+            g.addTransform(juce::AffineTransform::rotation(angle).translated(centre.x, centre.y));
+            g.setColour(theme.text);
+            g.fillRect(juce::Rectangle<float>(-1.6f, -radius + 10.0f, 3.2f, radius * 0.48f));
+        }
 
         g.setColour(theme.accent.withAlpha(0.2f));
-        g.fillEllipse(area.reduced(radius * 0.58f));
+        g.drawImage(art.cap, (art.capBounds + juce::Point<int>(x, y)).toFloat(), juce::RectanglePlacement::stretchToFit, true);
     }
 
     juce::Label* createSliderTextBox(juce::Slider& slider) override
@@ -80,7 +95,112 @@ public:
     }
 
 private:
+    static juce::Rectangle<float> getKnobArea(juce::Rectangle<int> sliderBounds)
+    {
+        return sliderBounds.toFloat().reduced(6.0f);
+    }
+
+    // Alpha masks for one knob size and display scale, tinted when drawn, so they do not depend on
+    // the theme. The arc strip holds numFrames square frames side by side, one per step of travel.
+    // Bounds are relative to the slider's rotary area.
+    struct KnobArt
+    {
+        static constexpr int numFrames = 128;
+
+        juce::Point<int> size;
+        float scale = 1.0f;
+        float startAngle = 0.0f;
+        float endAngle = 0.0f;
+
+        juce::Rectangle<int> arcBounds;
+        juce::Rectangle<int> capBounds;
+        juce::Image arcStrip;
+        juce::Image cap;
+    };
+
+    // Shared by every editor in the process. Editors have a fixed size, so there is one entry per
+    // knob size and display scale in use; the oldest is dropped past a handful.
+    class KnobArtCache
+    {
+    public:
+        const KnobArt& get(juce::Point<int> size, float scale, float startAngle, float endAngle)
+        {
+            for (const auto& art : entries)
+                if (art->size == size && juce::approximatelyEqual(art->scale, scale)
+                    && juce::approximatelyEqual(art->startAngle, startAngle) && juce::approximatelyEqual(art->endAngle, endAngle))
+                    return *art;
+
+            if (entries.size() >= maxEntries)
+                entries.erase(entries.begin());
+
+            entries.push_back(render(size, scale, startAngle, endAngle));
+            return *entries.back();
+        }
+
+    private:
+        static constexpr size_t maxEntries = 8;
+
+        // Renders `frames` copies of a layer covering `bounds` side by side at the given scale.
+        template <typename Draw>
+        static juce::Image renderMask(juce::Rectangle<int> bounds, float scale, int frames, Draw&& draw)
+        {
+            const auto frameWidth = juce::roundToInt((float) bounds.getWidth() * scale);
+            const auto frameHeight = juce::roundToInt((float) bounds.getHeight() * scale);
+            juce::Image image(juce::Image::SingleChannel, juce::jmax(1, frameWidth * frames), juce::jmax(1, frameHeight), true);
+            juce::Graphics g(image);
+            g.setColour(juce::Colours::white);
+
+            for (int frame = 0; frame < frames; ++frame)
+            {
+                juce::Graphics::ScopedSaveState frameState(g);
+                g.reduceClipRegion(frame * frameWidth, 0, frameWidth, frameHeight);
+                g.addTransform(juce::AffineTransform::translation((float) -bounds.getX(), (float) -bounds.getY())
+                                   .scaled(scale)
+                                   .translated((float) (frame * frameWidth), 0.0f));
+                draw(g, frame);
+            }
+
+            return image;
+        }
+
+        static std::unique_ptr<KnobArt> render(juce::Point<int> size, float scale, float startAngle, float endAngle)
+        {
+            auto art = std::make_unique<KnobArt>();
+            art->size = size;
+            art->scale = scale;
+            art->startAngle = startAngle;
+            art->endAngle = endAngle;
+
+            const auto area = getKnobArea({ size.x, size.y });
+            const auto radius = juce::jmin(area.getWidth(), area.getHeight()) * 0.5f;
+            const auto centre = area.getCentre();
+
+            // Square frames keep the strip small for the wide, flat knobs of the main page.
+            const auto arcSide = (int) std::ceil(radius * 2.0f);
+            art->arcBounds = juce::Rectangle<int>(arcSide, arcSide).withCentre(centre.roundToInt());
+            art->arcStrip = renderMask(art->arcBounds, scale, KnobArt::numFrames, [&](juce::Graphics& g, int frame)
+            {
+                const auto angle = juce::jmap((float) frame / (float) (KnobArt::numFrames - 1), startAngle, endAngle);
+                juce::Path arc;
+                arc.addCentredArc(centre.x, centre.y, radius - 6.0f, radius - 6.0f, 0.0f, startAngle, angle, true);
+                g.strokePath(arc, juce::PathStrokeType(4.0f, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+            });
+
+            const auto capArea = area.reduced(radius * 0.58f);
+            art->capBounds = capArea.getSmallestIntegerContainer();
+            art->cap = renderMask(art->capBounds, scale, 1, [&](juce::Graphics& g, int)
+            {
+                g.fillEllipse(capArea);
+            });
+
+            return art;
+        }
+
+        std::vector<std::unique_ptr<KnobArt>> entries;
+    };
+
     Theme theme;
+    juce::SharedResourcePointer<KnobArtCache> knobArt;
 };
 
 DigitalisAudioProcessorEditor::DigitalisAudioProcessorEditor(DigitalisAudioProcessor& p)
@@ -125,6 +245,23 @@ DigitalisAudioProcessorEditor::DigitalisAudioProcessorEditor(DigitalisAudioProce
     advancedTitle.setFont(sectionFont());
     addAndMakeVisible(advancedTitle);
 
+    qualityBox.setColour(juce::ComboBox::backgroundColourId, theme.panel.brighter(0.07f));
+    qualityBox.setColour(juce::ComboBox::textColourId, theme.text);
+    qualityBox.setColour(juce::ComboBox::outlineColourId, theme.accent.withAlpha(0.3f));
+    qualityBox.setColour(juce::ComboBox::buttonColourId, theme.panel.brighter(0.12f));
+    qualityBox.setColour(juce::ComboBox::arrowColourId, theme.text);
+    if (auto* quality = dynamic_cast<juce::AudioParameterChoice*>(state.getParameter("quality")))
+        qualityBox.addItemList(quality->choices, 1);
+    qualityAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(state, "quality", qualityBox);
+    addAndMakeVisible(qualityBox);
+
+    offlineThreadsButton.setButtonText("Offline Threads");
+    offlineThreadsButton.setColour(juce::ToggleButton::textColourId, theme.text);
+    offlineThreadsButton.setColour(juce::ToggleButton::tickColourId, theme.accent);
+    offlineThreadsButton.setColour(juce::ToggleButton::tickDisabledColourId, theme.text.withAlpha(0.5f));
+    offlineThreadsAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(state, "offlineThreads", offlineThreadsButton);
+    addAndMakeVisible(offlineThreadsButton);
+
     aboutBody.setJustificationType(juce::Justification::topLeft);
     aboutBody.setColour(juce::Label::textColourId, theme.text);
     aboutBody.setColour(juce::Label::backgroundColourId, theme.panel.brighter(0.05f));
@@ -254,6 +391,26 @@ DigitalisAudioProcessorEditor::~DigitalisAudioProcessorEditor()
 
 void DigitalisAudioProcessorEditor::paint(juce::Graphics& g)
 {
+    // The gradient, panel and knob faces only change with the layout, display scale or look and
+    // feel, so they live in an opaque layer. A knob repaint during automation copies its own
+    // region of it and draws the moving parts on top.
+    const auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const auto layerWidth = juce::roundToInt((float) getWidth() * scale);
+    const auto layerHeight = juce::roundToInt((float) getHeight() * scale);
+
+    if (backgroundLayer.getWidth() != layerWidth || backgroundLayer.getHeight() != layerHeight)
+        backgroundLayer = renderBackground(layerWidth, layerHeight, scale);
+
+    g.setOpacity(1.0f);
+    g.drawImage(backgroundLayer, getLocalBounds().toFloat());
+}
+
+juce::Image DigitalisAudioProcessorEditor::renderBackground(int width, int height, float scale)
+{
+    juce::Image layer(juce::Image::RGB, juce::jmax(1, width), juce::jmax(1, height), false);
+    juce::Graphics g(layer);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
     juce::ColourGradient bg(theme.bgTop, 0.0f, 0.0f, theme.bgBottom, 0.0f, (float) getHeight(), false);
     g.setGradientFill(bg);
     g.fillAll();
@@ -264,10 +421,29 @@ void DigitalisAudioProcessorEditor::paint(juce::Graphics& g)
 
     g.setColour(theme.accent.withAlpha(0.45f));
     g.drawRoundedRectangle(bounds.reduced(1.5f), 16.0f, 2.0f);
+
+    const auto drawFaces = [this, &g](auto& controls)
+    {
+        for (auto& control : controls)
+            if (control.knob.isVisible())
+                style->drawRotaryFace(g, style->getSliderLayout(control.knob).sliderBounds + control.knob.getPosition());
+    };
+    drawFaces(macros);
+    drawFaces(globals);
+    drawFaces(advanced);
+
+    return layer;
+}
+
+void DigitalisAudioProcessorEditor::lookAndFeelChanged()
+{
+    backgroundLayer = {};
 }
 
 void DigitalisAudioProcessorEditor::resized()
 {
+    backgroundLayer = {};
+
     auto area = getLocalBounds().reduced(28);
 
     auto header = area.removeFromTop(86);
@@ -322,7 +498,10 @@ void DigitalisAudioProcessorEditor::resized()
     }
     else if (currentPage == Page::advanced)
     {
-        advancedTitle.setBounds(area.removeFromTop(24).removeFromLeft(180));
+        auto advancedHeader = area.removeFromTop(24);
+        advancedTitle.setBounds(advancedHeader.removeFromLeft(180));
+        qualityBox.setBounds(advancedHeader.removeFromRight(160));
+        offlineThreadsButton.setBounds(advancedHeader.removeFromRight(150));
         auto advancedGrid = area.removeFromTop(460);
         const int cellW = advancedGrid.getWidth() / 2;
         const int cellH = advancedGrid.getHeight() / 2;
@@ -380,6 +559,8 @@ void DigitalisAudioProcessorEditor::setPage(Page page)
     }
 
     advancedTitle.setVisible(isAdvanced);
+    qualityBox.setVisible(isAdvanced);
+    offlineThreadsButton.setVisible(isAdvanced);
     for (auto& c : advanced)
     {
         c.caption.setVisible(isAdvanced);
@@ -404,6 +585,7 @@ DigitalisAudioProcessorEditor::Theme DigitalisAudioProcessorEditor::getTheme()
         case 8: return { fromHex(0x1B2316), fromHex(0x0F140B), fromHex(0x192214), fromHex(0x9FDF5A), fromHex(0xF4FFE7), fromHex(0xB9CEA7) };
         case 9: return { fromHex(0x22191A), fromHex(0x120D0E), fromHex(0x1D1415), fromHex(0xFF7A6A), fromHex(0xFFF1EE), fromHex(0xD4B1AB) };
         case 10: return { fromHex(0x181E29), fromHex(0x0D121A), fromHex(0x141B25), fromHex(0x79C7FF), fromHex(0xECF7FF), fromHex(0xA8C2D6) };
+        case 11: return { fromHex(0x1C1A24), fromHex(0x0E0D13), fromHex(0x18161F), fromHex(0xC9A2FF), fromHex(0xF6F0FF), fromHex(0xBDB3CC) };
         default: return { fromHex(0x1E1E1E), fromHex(0x101010), fromHex(0x1A1A1A), fromHex(0x7FC8FF), fromHex(0xF0F0F0), fromHex(0xB9B9B9) };
     }
 }
@@ -422,6 +604,7 @@ juce::String DigitalisAudioProcessorEditor::getSubtitle()
         case 8: return "Finite-state microloop deterministic machine";
         case 9: return "Classic repeat-buffer stutter workstation";
         case 10: return "Diskont-era melodic skip and jump composer";
+        case 11: return "Collapse, glitch, and stream engines in one chain";
         default: return "Digitalis";
     }
 }
@@ -530,6 +713,16 @@ std::array<DigitalisAudioProcessorEditor::ParamSpec, 8> DigitalisAudioProcessorE
             { "flutter", "Flutter" },
             { "blur", "Blur" }
         }};
+        case 11: return {{
+            { "collapse", "Collapse" },
+            { "mantissaBits", "Mantissa Bits" },
+            { "stress", "Engine Stress" },
+            { "seam", "Seam Error" },
+            { "artifact", "Artifact" },
+            { "bitrate", "Bitrate" },
+            { "packetLoss", "Packet Loss" },
+            { "smear", "Smear" }
+        }};
         default: return {{
             { "digital", "Digital" },
             { "mix", "Mix" },
@@ -547,17 +740,18 @@ std::array<DigitalisAudioProcessorEditor::ParamSpec, 4> DigitalisAudioProcessorE
 {
     switch (kPluginIndex)
     {
-        case 1: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        case 2: return {{ { "fbTone", "Feedback Tone" }, { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
-        case 3: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        case 4: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        case 5: return {{ { "preecho", "Pre Echo" }, { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
-        case 6: return {{ { "jitter", "Spectral Jitter" }, { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
-        case 7: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        case 8: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        case 9: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        case 10: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
-        default: return {{ { "mix", "Mix" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
+        case 1: return {{ { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
+        case 2: return {{ { "fbTone", "Feedback Tone" }, { "aliasAmt", "Alias Amount" }, { "limiter", "Limiter" }, { "output", "Output" } }};
+        case 3: return {{ { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
+        case 4: return {{ { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
+        case 5: return {{ { "preecho", "Pre Echo" }, { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
+        case 6: return {{ { "jitter", "Spectral Jitter" }, { "stereoLink", "Stereo Link" }, { "limiter", "Limiter" }, { "output", "Output" } }};
+        case 7: return {{ { "stereoLink", "Stereo Link" }, { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
+        case 8: return {{ { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
+        case 9: return {{ { "stereoLink", "Stereo Link" }, { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
+        case 10: return {{ { "stereoLink", "Stereo Link" }, { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "output", "Output" } }};
+        case 11: return {{ { "fpcBypass", "Collapse Bypass" }, { "bgeBypass", "Glitch Bypass" }, { "sagBypass", "Stream Bypass" }, { "preecho", "Pre Echo" } }};
+        default: return {{ { "limiter", "Limiter" }, { "autolevel", "Auto Level" }, { "safety", "Safety" }, { "output", "Output" } }};
     }
 }
 
@@ -14,6 +14,7 @@ public:
 
     void paint(juce::Graphics&) override;
     void resized() override;
+    void lookAndFeelChanged() override;
 
 private:
     void timerCallback() override;
@@ -57,12 +58,14 @@ private:
 
     void setupControl(Control& control, const ParamSpec& spec);
     void setPage(Page page);
+    juce::Image renderBackground(int width, int height, float scale);
 
     DigitalisAudioProcessor& processorRef;
     juce::AudioProcessorValueTreeState& state;
 
     Theme theme;
     std::unique_ptr<Style> style;
+    juce::Image backgroundLayer;
 
     juce::Label title;
     juce::Label subtitle;
@@ -76,6 +79,10 @@ private:
     juce::ComboBox presetBox;
     juce::Label aboutBody;
     juce::Label advancedTitle;
+    juce::ComboBox qualityBox;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> qualityAttachment;
+    juce::ToggleButton offlineThreadsButton;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> offlineThreadsAttachment;
 
     std::array<Control, 8> macros;
     std::array<Control, 4> globals;
@@ -0,0 +1,14 @@
+#include "PluginProcessor.h"
+#include "PluginEditor.h"
+
+// The plugin targets are this file and the editor; the processor itself comes from digitalis_dsp,
+// compiled for the same DIGITALIS_PLUGIN_INDEX.
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+{
+    DigitalisAudioProcessor::editorFactory = [](DigitalisAudioProcessor& processor) -> juce::AudioProcessorEditor*
+    {
+        return new DigitalisAudioProcessorEditor(processor);
+    };
+
+    return new DigitalisAudioProcessor();
+}
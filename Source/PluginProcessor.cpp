@@ -1,7 +1,13 @@
 #include "PluginProcessor.h"
-#include "PluginEditor.h"
-#include <bit>
+#include "DigitalisEngines.h"
+#include "DigitalisKernels.h"
+#include "RealtimeScope.h"
+#include <algorithm>
+#include <complex>
 #include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
 
 namespace
 {
@@ -21,60 +27,20 @@ juce::String pluginTag()
         case 8: return "Deterministic Machine";
         case 9: return "Classic Buffer Stutter";
         case 10: return "Melodic Skipping Engine";
+        case 11: return "Digitalis Chain";
         default: return "Digitalis";
     }
 }
 
-float quantise(float x, float steps)
-{
-    return std::round(x * steps) / steps;
-}
-
-float truncateMantissa(float x, int keepBits)
-{
-    if (keepBits >= 23 || !std::isfinite(x) || x == 0.0f)
-        return x;
-
-    const auto bits = std::bit_cast<std::uint32_t>(x);
-    const auto exponent = (bits >> 23u) & 0xffu;
-    if (exponent == 0u || exponent == 0xffu)
-        return x;
-
-    const auto dropBits = static_cast<std::uint32_t>(23 - juce::jlimit(1, 23, keepBits));
-    const auto mask = ~((1u << dropBits) - 1u);
-    const auto signAndExponent = bits & 0xff800000u;
-    const auto mantissa = bits & 0x007fffffu;
-    return std::bit_cast<float>(signAndExponent | (mantissa & mask));
-}
-
-float quantiseExponent(float x, int exponentStep)
-{
-    if (exponentStep <= 1 || !std::isfinite(x) || x == 0.0f)
-        return x;
+using digitalis::foldHashLanes;
+using digitalis::followEnvelope;
+using digitalis::hashSamples;
+using digitalis::quantise;
+using digitalis::quantiseExponent;
+using digitalis::seedHashLanes;
+using digitalis::truncateMantissa;
 
-    const auto bits = std::bit_cast<std::uint32_t>(x);
-    const auto exponent = (bits >> 23u) & 0xffu;
-    if (exponent == 0u || exponent == 0xffu)
-        return x;
-
-    const auto unbiased = static_cast<int>(exponent) - 127;
-    const auto q = static_cast<int>(std::round(static_cast<float>(unbiased) / static_cast<float>(exponentStep))) * exponentStep;
-    const auto clamped = juce::jlimit(-126, 127, q);
-    const auto newExponent = static_cast<std::uint32_t>(clamped + 127);
-
-    const auto signAndMantissa = bits & 0x807fffffu;
-    return std::bit_cast<float>(signAndMantissa | (newExponent << 23u));
-}
-
-std::uint32_t hashStep(std::uint32_t hash, float x)
-{
-    const auto q = static_cast<std::int32_t>(std::round(juce::jlimit(-1.0f, 1.0f, x) * 32767.0f));
-    hash ^= static_cast<std::uint32_t>(q);
-    hash *= 16777619u;
-    return hash;
-}
-
-float defaultAutoLevelPercent()
+constexpr float defaultAutoLevelPercent()
 {
     switch (kPluginIndex)
     {
@@ -88,11 +54,12 @@ float defaultAutoLevelPercent()
         case 8: return 48.0f; // Deterministic Machine
         case 9: return 50.0f; // Classic Buffer Stutter
         case 10: return 47.0f; // Melodic Skipping Engine
+        case 11: return 50.0f; // Digitalis Chain
         default: return 45.0f;
     }
 }
 
-float defaultSafetyPercent()
+constexpr float defaultSafetyPercent()
 {
     switch (kPluginIndex)
     {
@@ -106,11 +73,12 @@ float defaultSafetyPercent()
         case 8: return 63.0f;
         case 9: return 66.0f;
         case 10: return 68.0f;
+        case 11: return 74.0f;
         default: return 62.0f;
     }
 }
 
-float defaultOutputTrimDb()
+constexpr float defaultOutputTrimDb()
 {
     switch (kPluginIndex)
     {
@@ -124,6 +92,7 @@ float defaultOutputTrimDb()
         case 8: return -16.1f;
         case 9: return -10.0f;
         case 10: return -10.7f;
+        case 11: return -10.4f;
         default: return 0.0f;
     }
 }
@@ -142,9 +111,669 @@ float targetRmsForPlugin()
         case 8: return 0.165f;
         case 9: return 0.17f;
         case 10: return 0.17f;
+        case 11: return 0.16f;
         default: return 0.18f;
     }
 }
+
+// Anything below -120 dBFS counts as silence when deciding whether an instance can sleep.
+constexpr float kSilenceThreshold = 1.0e-6f;
+
+// Longest tail reported to the host. A latched feedback loop never dies away, but hosts read an
+// infinite tail in different ways, and some read it as no tail at all.
+constexpr double kMaxTailSeconds = 30.0;
+
+bool isQuiet(const std::array<float, 2>& state)
+{
+    return std::abs(state[0]) < kSilenceThreshold && std::abs(state[1]) < kSilenceThreshold;
+}
+
+// Steps for a full-scale value scaled by retain (below 1) on every step to reach kSilenceThreshold.
+int decaySteps(float retain)
+{
+    return retain > 0.0f ? static_cast<int>(std::ceil(std::log(kSilenceThreshold) / std::log(retain))) : 0;
+}
+
+// FNV-1a over the parameter ID; stable across builds so it can key saved state.
+constexpr std::uint32_t hashParameterId(std::string_view id) noexcept
+{
+    auto hash = 2166136261u;
+    for (const auto c : id)
+        hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u;
+    return hash;
+}
+
+// Binary state: magic, version, plugin index, program, then (ID hash, value) records.
+constexpr int kStateMagic = 0x44475354; // "DGST"
+constexpr short kStateVersion = 1;
+constexpr int kStateHeaderSize = 16;
+constexpr int kStateRecordSize = 8;
+
+// The chain target runs several engines back to back on one buffer, sharing a single
+// post-safety and dry/wet stage. Engines are listed in processing order; their parameter
+// IDs must not collide because they all live in the same APVTS.
+constexpr int kChainPluginIndex = 11;
+
+struct ChainSlot
+{
+    int engine;
+    const char* bypassId;
+    const char* bypassName;
+};
+
+constexpr std::array<ChainSlot, 3> kChainSlots {{
+    { 1, "fpcBypass", "Collapse Bypass" },
+    { 3, "bgeBypass", "Glitch Bypass" },
+    { 5, "sagBypass", "Stream Bypass" }
+}};
+
+// Parameter IDs in layout order, as created by addEngineParameters and createParameterLayout.
+// The constructor checks the order in debug builds.
+constexpr std::array<std::string_view, 8> kCollapseParameterIds { "collapse", "mantissaBits", "exponentStep", "temporalHold", "blockSize", "quantCurve", "rounding", "denormal" };
+constexpr std::array<std::string_view, 10> kNyquistParameterIds { "destroy", "minSR", "maxSR", "modRate", "modDepth", "interpErr", "transient", "feedback", "fbTone", "aliasAmt" };
+constexpr std::array<std::string_view, 7> kGlitchParameterIds { "stress", "baseBlock", "blockJitter", "seam", "tailDrop", "reorder", "lookFail" };
+constexpr std::array<std::string_view, 7> kQuantiserParameterIds { "brutal", "gridMode", "stepDiv", "zipper", "levels", "phaseLock", "jitter" };
+constexpr std::array<std::string_view, 9> kStreamingParameterIds { "artifact", "bitrate", "masking", "smear", "codecMode", "switchMs", "packetLoss", "burst", "preecho" };
+constexpr std::array<std::string_view, 10> kSpectralParameterIds { "brutalism", "binDensity", "cluster", "freezeRate", "freezeLen", "phaseScramble", "phaseSteps", "sortAmount", "jitter", "stereoLink" };
+constexpr std::array<std::string_view, 8> kOverclockParameterIds { "overclock", "sensitivity", "failureRate", "latencySpike", "desync", "thermal", "recovery", "stereoLink" };
+constexpr std::array<std::string_view, 7> kDeterministicParameterIds { "determinism", "stateCount", "stateDwell", "loopMs", "hashWindow", "jumpRule", "memory" };
+constexpr std::array<std::string_view, 8> kStutterParameterIds { "amount", "rateHz", "sliceMs", "repeats", "reverse", "timingJitter", "duck", "stereoLink" };
+constexpr std::array<std::string_view, 9> kSkippingParameterIds { "skip", "jumpRate", "segMs", "melody", "spread", "reverse", "flutter", "blur", "stereoLink" };
+constexpr std::array<std::string_view, 1> kFallbackParameterIds { "digital" };
+constexpr std::array<std::string_view, 7> kCommonParameterIds { "autolevel", "safety", "output", "mix", "limiter", "quality", "offlineThreads" };
+
+constexpr std::span<const std::string_view> engineParameterIds(int engine)
+{
+    switch (engine)
+    {
+        case 1: return kCollapseParameterIds;
+        case 2: return kNyquistParameterIds;
+        case 3: return kGlitchParameterIds;
+        case 4: return kQuantiserParameterIds;
+        case 5: return kStreamingParameterIds;
+        case 6: return kSpectralParameterIds;
+        case 7: return kOverclockParameterIds;
+        case 8: return kDeterministicParameterIds;
+        case 9: return kStutterParameterIds;
+        case 10: return kSkippingParameterIds;
+        default: return kFallbackParameterIds;
+    }
+}
+
+constexpr int kMaxParameters = 40;
+
+struct ParameterIdTable
+{
+    std::array<std::string_view, kMaxParameters> ids {};
+    int size = 0;
+
+    constexpr void add(std::string_view id) { ids[(size_t) size++] = id; }
+
+    constexpr void add(std::span<const std::string_view> more)
+    {
+        for (const auto id : more)
+            add(id);
+    }
+
+    constexpr int indexOf(std::string_view id) const
+    {
+        for (int i = 0; i < size; ++i)
+            if (ids[(size_t) i] == id)
+                return i;
+
+        return -1;
+    }
+};
+
+constexpr ParameterIdTable makeParameterIdTable()
+{
+    ParameterIdTable table;
+
+    if (kPluginIndex == kChainPluginIndex)
+    {
+        for (const auto& slot : kChainSlots)
+        {
+            table.add(engineParameterIds(slot.engine));
+            table.add(slot.bypassId);
+        }
+    }
+    else
+    {
+        table.add(engineParameterIds(kPluginIndex));
+    }
+
+    table.add(kCommonParameterIds);
+    return table;
+}
+
+constexpr auto kParameterIds = makeParameterIdTable();
+
+// State slot keys in hash order, so the constructor only has to attach parameter pointers.
+struct StateKey
+{
+    std::uint32_t idHash;
+    int parameter;
+};
+
+constexpr std::array<StateKey, kMaxParameters> makeStateKeys()
+{
+    std::array<StateKey, kMaxParameters> keys {};
+
+    for (int i = 0; i < kParameterIds.size; ++i)
+        keys[(size_t) i] = { hashParameterId(kParameterIds.ids[(size_t) i]), i };
+
+    std::sort(keys.begin(), keys.begin() + kParameterIds.size, [](const auto& a, const auto& b) { return a.idHash < b.idHash; });
+    return keys;
+}
+
+constexpr auto kStateKeys = makeStateKeys();
+
+constexpr bool stateKeysAreUnique()
+{
+    for (int i = 1; i < kParameterIds.size; ++i)
+        if (kStateKeys[(size_t) i].idHash == kStateKeys[(size_t) i - 1].idHash)
+            return false;
+
+    return true;
+}
+
+static_assert(stateKeysAreUnique(), "two parameter IDs share an FNV-1a hash");
+
+// Factory presets live in read-only tables. Values are plain (not normalised) and address
+// parameters by layout index; makePreset resolves each ID while the table is being built, so an
+// unknown ID fails to compile.
+struct PresetValue
+{
+    int parameter;
+    float value;
+};
+
+struct FactoryPreset
+{
+    const char* name = nullptr;
+    std::array<PresetValue, kMaxParameters> values {};
+    int numValues = 0;
+};
+
+struct PresetEntry
+{
+    std::string_view id;
+    float value;
+};
+
+constexpr FactoryPreset makePreset(const char* name, std::initializer_list<PresetEntry> entries)
+{
+    FactoryPreset preset;
+    preset.name = name;
+
+    for (const auto& entry : entries)
+    {
+        const auto index = kParameterIds.indexOf(entry.id);
+        if (index < 0)
+            throw "factory preset names a parameter this plugin does not have";
+
+        preset.values[(size_t) preset.numValues++] = { index, entry.value };
+    }
+
+    return preset;
+}
+
+template <int PluginIndex>
+constexpr auto makeFactoryPresets()
+{
+    if constexpr (PluginIndex == 1)
+    {
+        return std::array {
+            makePreset("Init", {{ "collapse", 5.0f }, { "mantissaBits", 23.0f }, { "exponentStep", 1.0f }, { "temporalHold", 0.0f }, { "blockSize", 0.0f }, { "quantCurve", 0.0f }, { "rounding", 0.0f }, { "denormal", 0.0f }, { "mix", 100.0f }, { "autolevel", 58.0f }, { "safety", 66.0f }, { "output", -10.1f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "collapse", 22.0f }, { "mantissaBits", 16.0f }, { "exponentStep", 2.0f }, { "temporalHold", 2.0f }, { "blockSize", 2.0f }, { "quantCurve", 2.0f }, { "rounding", 8.0f }, { "denormal", 2.0f }, { "mix", 32.0f }, { "autolevel", 62.0f }, { "safety", 70.0f }, { "output", -1.6f } }),
+            makePreset("Subtle Dust", {{ "collapse", 30.0f }, { "mantissaBits", 14.0f }, { "exponentStep", 2.0f }, { "temporalHold", 2.0f }, { "blockSize", 2.0f }, { "quantCurve", 1.0f }, { "rounding", 12.0f }, { "denormal", 2.0f }, { "mix", 45.0f }, { "autolevel", 60.0f }, { "safety", 69.0f }, { "output", -1.4f } }),
+            makePreset("Subtle Glass", {{ "collapse", 35.0f }, { "mantissaBits", 12.0f }, { "exponentStep", 3.0f }, { "temporalHold", 3.0f }, { "blockSize", 3.0f }, { "quantCurve", 2.0f }, { "rounding", 15.0f }, { "denormal", 4.0f }, { "mix", 50.0f }, { "autolevel", 59.0f }, { "safety", 69.0f }, { "output", -1.3f } }),
+            makePreset("Medium Crunch", {{ "collapse", 55.0f }, { "mantissaBits", 10.0f }, { "exponentStep", 4.0f }, { "temporalHold", 3.0f }, { "blockSize", 4.0f }, { "quantCurve", 2.0f }, { "rounding", 24.0f }, { "denormal", 8.0f }, { "mix", 68.0f }, { "autolevel", 58.0f }, { "safety", 70.0f }, { "output", -1.1f } }),
+            makePreset("Medium Pump", {{ "collapse", 60.0f }, { "mantissaBits", 9.0f }, { "exponentStep", 5.0f }, { "temporalHold", 4.0f }, { "blockSize", 4.0f }, { "quantCurve", 3.0f }, { "rounding", 30.0f }, { "denormal", 10.0f }, { "mix", 72.0f }, { "autolevel", 57.0f }, { "safety", 72.0f }, { "output", -1.0f } }),
+            makePreset("Extreme Ruin", {{ "collapse", 85.0f }, { "mantissaBits", 6.0f }, { "exponentStep", 9.0f }, { "temporalHold", 6.0f }, { "blockSize", 6.0f }, { "quantCurve", 3.0f }, { "rounding", 60.0f }, { "denormal", 25.0f }, { "mix", 100.0f }, { "autolevel", 55.0f }, { "safety", 78.0f }, { "output", -2.0f } }),
+            makePreset("Extreme Floatfire", {{ "collapse", 95.0f }, { "mantissaBits", 4.0f }, { "exponentStep", 12.0f }, { "temporalHold", 7.0f }, { "blockSize", 7.0f }, { "quantCurve", 3.0f }, { "rounding", 80.0f }, { "denormal", 40.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 82.0f }, { "output", -3.0f } }),
+            makePreset("Rhythmic Steps", {{ "collapse", 70.0f }, { "mantissaBits", 8.0f }, { "exponentStep", 6.0f }, { "temporalHold", 5.0f }, { "blockSize", 4.0f }, { "quantCurve", 0.0f }, { "rounding", 35.0f }, { "denormal", 8.0f }, { "mix", 78.0f }, { "autolevel", 56.0f }, { "safety", 74.0f }, { "output", -1.6f } }),
+            makePreset("Rhythmic Pulsar", {{ "collapse", 75.0f }, { "mantissaBits", 7.0f }, { "exponentStep", 7.0f }, { "temporalHold", 6.0f }, { "blockSize", 5.0f }, { "quantCurve", 1.0f }, { "rounding", 45.0f }, { "denormal", 12.0f }, { "mix", 80.0f }, { "autolevel", 56.0f }, { "safety", 75.0f }, { "output", -1.8f } })
+        };
+    }
+    else if constexpr (PluginIndex == 2)
+    {
+        return std::array {
+            makePreset("Init", {{ "destroy", 4.0f }, { "minSR", 22050.0f }, { "maxSR", 48000.0f }, { "modRate", 0.2f }, { "modDepth", 0.0f }, { "interpErr", 0.0f }, { "transient", 0.0f }, { "feedback", 0.0f }, { "fbTone", 50.0f }, { "aliasAmt", 100.0f }, { "mix", 100.0f }, { "autolevel", 46.0f }, { "safety", 61.0f }, { "output", -9.6f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "destroy", 28.0f }, { "minSR", 12000.0f }, { "maxSR", 48000.0f }, { "modRate", 0.7f }, { "modDepth", 35.0f }, { "interpErr", 20.0f }, { "transient", 26.0f }, { "feedback", 8.0f }, { "fbTone", 46.0f }, { "aliasAmt", 100.0f }, { "mix", 35.0f }, { "autolevel", 52.0f }, { "safety", 66.0f }, { "output", -1.2f } }),
+            makePreset("Subtle Fold", {{ "destroy", 35.0f }, { "minSR", 9000.0f }, { "maxSR", 44100.0f }, { "modRate", 0.9f }, { "modDepth", 42.0f }, { "interpErr", 28.0f }, { "transient", 30.0f }, { "feedback", 12.0f }, { "fbTone", 42.0f }, { "aliasAmt", 100.0f }, { "mix", 52.0f }, { "autolevel", 50.0f }, { "safety", 67.0f }, { "output", -1.0f } }),
+            makePreset("Subtle Mirror", {{ "destroy", 40.0f }, { "minSR", 7600.0f }, { "maxSR", 48000.0f }, { "modRate", 1.3f }, { "modDepth", 46.0f }, { "interpErr", 30.0f }, { "transient", 35.0f }, { "feedback", 14.0f }, { "fbTone", 55.0f }, { "aliasAmt", 100.0f }, { "mix", 56.0f }, { "autolevel", 49.0f }, { "safety", 68.0f }, { "output", -1.1f } }),
+            makePreset("Medium Shred", {{ "destroy", 58.0f }, { "minSR", 5500.0f }, { "maxSR", 44100.0f }, { "modRate", 2.1f }, { "modDepth", 62.0f }, { "interpErr", 48.0f }, { "transient", 56.0f }, { "feedback", 22.0f }, { "fbTone", 50.0f }, { "aliasAmt", 100.0f }, { "mix", 74.0f }, { "autolevel", 47.0f }, { "safety", 70.0f }, { "output", -1.4f } }),
+            makePreset("Medium Motion", {{ "destroy", 64.0f }, { "minSR", 4200.0f }, { "maxSR", 52000.0f }, { "modRate", 3.4f }, { "modDepth", 70.0f }, { "interpErr", 56.0f }, { "transient", 62.0f }, { "feedback", 28.0f }, { "fbTone", 36.0f }, { "aliasAmt", 100.0f }, { "mix", 78.0f }, { "autolevel", 46.0f }, { "safety", 72.0f }, { "output", -1.6f } }),
+            makePreset("Extreme Shatter", {{ "destroy", 90.0f }, { "minSR", 1800.0f }, { "maxSR", 96000.0f }, { "modRate", 8.0f }, { "modDepth", 92.0f }, { "interpErr", 88.0f }, { "transient", 90.0f }, { "feedback", 55.0f }, { "fbTone", 30.0f }, { "aliasAmt", 100.0f }, { "mix", 100.0f }, { "autolevel", 43.0f }, { "safety", 79.0f }, { "output", -2.8f } }),
+            makePreset("Extreme Spiral", {{ "destroy", 96.0f }, { "minSR", 1000.0f }, { "maxSR", 96000.0f }, { "modRate", 15.0f }, { "modDepth", 98.0f }, { "interpErr", 95.0f }, { "transient", 95.0f }, { "feedback", 72.0f }, { "fbTone", 22.0f }, { "aliasAmt", 100.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 84.0f }, { "output", -3.4f } }),
+            makePreset("Rhythmic Fold", {{ "destroy", 72.0f }, { "minSR", 3200.0f }, { "maxSR", 42000.0f }, { "modRate", 4.0f }, { "modDepth", 76.0f }, { "interpErr", 64.0f }, { "transient", 70.0f }, { "feedback", 30.0f }, { "fbTone", 44.0f }, { "aliasAmt", 100.0f }, { "mix", 82.0f }, { "autolevel", 45.0f }, { "safety", 74.0f }, { "output", -1.9f } }),
+            makePreset("Rhythmic Alias Kick", {{ "destroy", 78.0f }, { "minSR", 2600.0f }, { "maxSR", 36000.0f }, { "modRate", 6.2f }, { "modDepth", 84.0f }, { "interpErr", 72.0f }, { "transient", 82.0f }, { "feedback", 42.0f }, { "fbTone", 40.0f }, { "aliasAmt", 100.0f }, { "mix", 86.0f }, { "autolevel", 44.0f }, { "safety", 76.0f }, { "output", -2.2f } })
+        };
+    }
+    else if constexpr (PluginIndex == 3)
+    {
+        return std::array {
+            makePreset("Init", {{ "stress", 4.0f }, { "baseBlock", 2.0f }, { "blockJitter", 0.0f }, { "seam", 0.0f }, { "tailDrop", 0.0f }, { "reorder", 0.0f }, { "lookFail", 0.0f }, { "mix", 100.0f }, { "autolevel", 52.0f }, { "safety", 70.0f }, { "output", -9.7f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "stress", 25.0f }, { "baseBlock", 2.0f }, { "blockJitter", 25.0f }, { "seam", 15.0f }, { "tailDrop", 8.0f }, { "reorder", 12.0f }, { "lookFail", 10.0f }, { "mix", 30.0f }, { "autolevel", 58.0f }, { "safety", 74.0f }, { "output", -2.2f } }),
+            makePreset("Subtle Drift", {{ "stress", 34.0f }, { "baseBlock", 2.0f }, { "blockJitter", 36.0f }, { "seam", 24.0f }, { "tailDrop", 10.0f }, { "reorder", 18.0f }, { "lookFail", 14.0f }, { "mix", 50.0f }, { "autolevel", 56.0f }, { "safety", 73.0f }, { "output", -2.0f } }),
+            makePreset("Subtle Slips", {{ "stress", 38.0f }, { "baseBlock", 3.0f }, { "blockJitter", 32.0f }, { "seam", 30.0f }, { "tailDrop", 14.0f }, { "reorder", 24.0f }, { "lookFail", 18.0f }, { "mix", 54.0f }, { "autolevel", 55.0f }, { "safety", 74.0f }, { "output", -2.1f } }),
+            makePreset("Medium Stutter", {{ "stress", 56.0f }, { "baseBlock", 1.0f }, { "blockJitter", 58.0f }, { "seam", 44.0f }, { "tailDrop", 28.0f }, { "reorder", 42.0f }, { "lookFail", 36.0f }, { "mix", 76.0f }, { "autolevel", 52.0f }, { "safety", 76.0f }, { "output", -2.4f } }),
+            makePreset("Medium Seams", {{ "stress", 62.0f }, { "baseBlock", 0.0f }, { "blockJitter", 64.0f }, { "seam", 56.0f }, { "tailDrop", 30.0f }, { "reorder", 48.0f }, { "lookFail", 40.0f }, { "mix", 80.0f }, { "autolevel", 51.0f }, { "safety", 77.0f }, { "output", -2.6f } }),
+            makePreset("Extreme Engine Fail", {{ "stress", 90.0f }, { "baseBlock", 0.0f }, { "blockJitter", 95.0f }, { "seam", 88.0f }, { "tailDrop", 72.0f }, { "reorder", 86.0f }, { "lookFail", 78.0f }, { "mix", 100.0f }, { "autolevel", 45.0f }, { "safety", 84.0f }, { "output", -4.0f } }),
+            makePreset("Extreme Buffer Crash", {{ "stress", 96.0f }, { "baseBlock", 0.0f }, { "blockJitter", 100.0f }, { "seam", 94.0f }, { "tailDrop", 84.0f }, { "reorder", 94.0f }, { "lookFail", 92.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 87.0f }, { "output", -5.0f } }),
+            makePreset("Rhythmic Chunks", {{ "stress", 70.0f }, { "baseBlock", 1.0f }, { "blockJitter", 72.0f }, { "seam", 50.0f }, { "tailDrop", 40.0f }, { "reorder", 62.0f }, { "lookFail", 50.0f }, { "mix", 84.0f }, { "autolevel", 49.0f }, { "safety", 79.0f }, { "output", -3.0f } }),
+            makePreset("Rhythmic Shard Gate", {{ "stress", 78.0f }, { "baseBlock", 0.0f }, { "blockJitter", 82.0f }, { "seam", 62.0f }, { "tailDrop", 52.0f }, { "reorder", 72.0f }, { "lookFail", 64.0f }, { "mix", 88.0f }, { "autolevel", 48.0f }, { "safety", 80.0f }, { "output", -3.4f } })
+        };
+    }
+    else if constexpr (PluginIndex == 4)
+    {
+        return std::array {
+            makePreset("Init", {{ "brutal", 42.0f }, { "gridMode", 1.0f }, { "stepDiv", 4.0f }, { "zipper", 42.0f }, { "levels", 12.0f }, { "phaseLock", 72.0f }, { "jitter", 6.0f }, { "mix", 100.0f }, { "autolevel", 54.0f }, { "safety", 58.0f }, { "output", 1.5f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "brutal", 24.0f }, { "gridMode", 1.0f }, { "stepDiv", 3.0f }, { "zipper", 14.0f }, { "levels", 24.0f }, { "phaseLock", 25.0f }, { "jitter", 4.0f }, { "mix", 34.0f }, { "autolevel", 58.0f }, { "safety", 64.0f }, { "output", -1.0f } }),
+            makePreset("Subtle Stepped", {{ "brutal", 32.0f }, { "gridMode", 1.0f }, { "stepDiv", 4.0f }, { "zipper", 20.0f }, { "levels", 20.0f }, { "phaseLock", 35.0f }, { "jitter", 8.0f }, { "mix", 52.0f }, { "autolevel", 56.0f }, { "safety", 63.0f }, { "output", -0.8f } }),
+            makePreset("Subtle Quant Grid", {{ "brutal", 38.0f }, { "gridMode", 0.0f }, { "stepDiv", 4.0f }, { "zipper", 28.0f }, { "levels", 16.0f }, { "phaseLock", 46.0f }, { "jitter", 7.0f }, { "mix", 56.0f }, { "autolevel", 55.0f }, { "safety", 64.0f }, { "output", -0.9f } }),
+            makePreset("Medium Brutal Seq", {{ "brutal", 58.0f }, { "gridMode", 2.0f }, { "stepDiv", 5.0f }, { "zipper", 48.0f }, { "levels", 10.0f }, { "phaseLock", 62.0f }, { "jitter", 10.0f }, { "mix", 74.0f }, { "autolevel", 53.0f }, { "safety", 66.0f }, { "output", -1.2f } }),
+            makePreset("Medium Stair Drive", {{ "brutal", 64.0f }, { "gridMode", 0.0f }, { "stepDiv", 6.0f }, { "zipper", 56.0f }, { "levels", 8.0f }, { "phaseLock", 70.0f }, { "jitter", 12.0f }, { "mix", 78.0f }, { "autolevel", 52.0f }, { "safety", 67.0f }, { "output", -1.3f } }),
+            makePreset("Extreme Zipper", {{ "brutal", 92.0f }, { "gridMode", 0.0f }, { "stepDiv", 7.0f }, { "zipper", 95.0f }, { "levels", 4.0f }, { "phaseLock", 90.0f }, { "jitter", 18.0f }, { "mix", 100.0f }, { "autolevel", 48.0f }, { "safety", 73.0f }, { "output", -2.0f } }),
+            makePreset("Extreme Clocked Bits", {{ "brutal", 96.0f }, { "gridMode", 2.0f }, { "stepDiv", 7.0f }, { "zipper", 88.0f }, { "levels", 3.0f }, { "phaseLock", 100.0f }, { "jitter", 24.0f }, { "mix", 100.0f }, { "autolevel", 47.0f }, { "safety", 74.0f }, { "output", -2.4f } }),
+            makePreset("Rhythmic Grid Chop", {{ "brutal", 72.0f }, { "gridMode", 2.0f }, { "stepDiv", 6.0f }, { "zipper", 60.0f }, { "levels", 6.0f }, { "phaseLock", 84.0f }, { "jitter", 14.0f }, { "mix", 84.0f }, { "autolevel", 50.0f }, { "safety", 69.0f }, { "output", -1.6f } }),
+            makePreset("Rhythmic Phase Snap", {{ "brutal", 78.0f }, { "gridMode", 2.0f }, { "stepDiv", 5.0f }, { "zipper", 68.0f }, { "levels", 5.0f }, { "phaseLock", 96.0f }, { "jitter", 10.0f }, { "mix", 86.0f }, { "autolevel", 49.0f }, { "safety", 70.0f }, { "output", -1.8f } })
+        };
+    }
+    else if constexpr (PluginIndex == 5)
+    {
+        return std::array {
+            makePreset("Init", {{ "artifact", 4.0f }, { "bitrate", 320.0f }, { "masking", 0.0f }, { "smear", 0.0f }, { "codecMode", 0.0f }, { "switchMs", 400.0f }, { "packetLoss", 0.0f }, { "burst", 0.0f }, { "preecho", 0.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 72.0f }, { "output", -8.4f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "artifact", 24.0f }, { "bitrate", 160.0f }, { "masking", 24.0f }, { "smear", 18.0f }, { "codecMode", 1.0f }, { "switchMs", 360.0f }, { "packetLoss", 8.0f }, { "burst", 16.0f }, { "preecho", 10.0f }, { "mix", 30.0f }, { "autolevel", 50.0f }, { "safety", 76.0f }, { "output", -3.0f } }),
+            makePreset("Subtle Stream Wear", {{ "artifact", 34.0f }, { "bitrate", 128.0f }, { "masking", 34.0f }, { "smear", 28.0f }, { "codecMode", 1.0f }, { "switchMs", 300.0f }, { "packetLoss", 12.0f }, { "burst", 24.0f }, { "preecho", 14.0f }, { "mix", 48.0f }, { "autolevel", 47.0f }, { "safety", 76.0f }, { "output", -2.8f } }),
+            makePreset("Subtle Codec Drift", {{ "artifact", 40.0f }, { "bitrate", 112.0f }, { "masking", 42.0f }, { "smear", 36.0f }, { "codecMode", 2.0f }, { "switchMs", 240.0f }, { "packetLoss", 14.0f }, { "burst", 28.0f }, { "preecho", 18.0f }, { "mix", 54.0f }, { "autolevel", 46.0f }, { "safety", 77.0f }, { "output", -3.0f } }),
+            makePreset("Medium Artifact Bed", {{ "artifact", 58.0f }, { "bitrate", 84.0f }, { "masking", 62.0f }, { "smear", 50.0f }, { "codecMode", 1.0f }, { "switchMs", 200.0f }, { "packetLoss", 22.0f }, { "burst", 40.0f }, { "preecho", 28.0f }, { "mix", 74.0f }, { "autolevel", 44.0f }, { "safety", 80.0f }, { "output", -3.4f } }),
+            makePreset("Medium GSM Dust", {{ "artifact", 64.0f }, { "bitrate", 64.0f }, { "masking", 70.0f }, { "smear", 58.0f }, { "codecMode", 0.0f }, { "switchMs", 180.0f }, { "packetLoss", 28.0f }, { "burst", 52.0f }, { "preecho", 34.0f }, { "mix", 78.0f }, { "autolevel", 43.0f }, { "safety", 81.0f }, { "output", -3.8f } }),
+            makePreset("Extreme Packet Storm", {{ "artifact", 92.0f }, { "bitrate", 20.0f }, { "masking", 95.0f }, { "smear", 84.0f }, { "codecMode", 2.0f }, { "switchMs", 90.0f }, { "packetLoss", 72.0f }, { "burst", 90.0f }, { "preecho", 68.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 88.0f }, { "output", -5.2f } }),
+            makePreset("Extreme Modem Hell", {{ "artifact", 98.0f }, { "bitrate", 8.0f }, { "masking", 100.0f }, { "smear", 96.0f }, { "codecMode", 2.0f }, { "switchMs", 60.0f }, { "packetLoss", 86.0f }, { "burst", 100.0f }, { "preecho", 84.0f }, { "mix", 100.0f }, { "autolevel", 34.0f }, { "safety", 90.0f }, { "output", -6.5f } }),
+            makePreset("Rhythmic Drop Frames", {{ "artifact", 74.0f }, { "bitrate", 42.0f }, { "masking", 78.0f }, { "smear", 62.0f }, { "codecMode", 1.0f }, { "switchMs", 180.0f }, { "packetLoss", 44.0f }, { "burst", 70.0f }, { "preecho", 36.0f }, { "mix", 84.0f }, { "autolevel", 41.0f }, { "safety", 84.0f }, { "output", -4.4f } }),
+            makePreset("Rhythmic Switch Jam", {{ "artifact", 80.0f }, { "bitrate", 36.0f }, { "masking", 84.0f }, { "smear", 70.0f }, { "codecMode", 2.0f }, { "switchMs", 120.0f }, { "packetLoss", 50.0f }, { "burst", 76.0f }, { "preecho", 44.0f }, { "mix", 88.0f }, { "autolevel", 40.0f }, { "safety", 85.0f }, { "output", -4.9f } })
+        };
+    }
+    else if constexpr (PluginIndex == 6)
+    {
+        return std::array {
+            makePreset("Init", {{ "brutalism", 4.0f }, { "binDensity", 0.0f }, { "cluster", 0.0f }, { "freezeRate", 0.0f }, { "freezeLen", 60.0f }, { "phaseScramble", 0.0f }, { "phaseSteps", 64.0f }, { "sortAmount", 0.0f }, { "jitter", 0.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 36.0f }, { "safety", 76.0f }, { "output", -10.0f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "brutalism", 24.0f }, { "binDensity", 24.0f }, { "cluster", 1.0f }, { "freezeRate", 10.0f }, { "freezeLen", 120.0f }, { "phaseScramble", 14.0f }, { "phaseSteps", 24.0f }, { "sortAmount", 16.0f }, { "jitter", 8.0f }, { "stereoLink", 0.0f }, { "mix", 28.0f }, { "autolevel", 43.0f }, { "safety", 80.0f }, { "output", -3.2f } }),
+            makePreset("Subtle Spectral Tilt", {{ "brutalism", 36.0f }, { "binDensity", 32.0f }, { "cluster", 2.0f }, { "freezeRate", 16.0f }, { "freezeLen", 180.0f }, { "phaseScramble", 20.0f }, { "phaseSteps", 20.0f }, { "sortAmount", 24.0f }, { "jitter", 12.0f }, { "stereoLink", 0.0f }, { "mix", 50.0f }, { "autolevel", 41.0f }, { "safety", 80.0f }, { "output", -3.0f } }),
+            makePreset("Subtle Frozen Glass", {{ "brutalism", 42.0f }, { "binDensity", 38.0f }, { "cluster", 2.0f }, { "freezeRate", 28.0f }, { "freezeLen", 260.0f }, { "phaseScramble", 28.0f }, { "phaseSteps", 16.0f }, { "sortAmount", 30.0f }, { "jitter", 16.0f }, { "stereoLink", 0.0f }, { "mix", 56.0f }, { "autolevel", 40.0f }, { "safety", 81.0f }, { "output", -3.2f } }),
+            makePreset("Medium Bin Vandal", {{ "brutalism", 62.0f }, { "binDensity", 58.0f }, { "cluster", 3.0f }, { "freezeRate", 36.0f }, { "freezeLen", 320.0f }, { "phaseScramble", 52.0f }, { "phaseSteps", 12.0f }, { "sortAmount", 48.0f }, { "jitter", 24.0f }, { "stereoLink", 0.0f }, { "mix", 76.0f }, { "autolevel", 38.0f }, { "safety", 83.0f }, { "output", -3.8f } }),
+            makePreset("Medium Phase Teeth", {{ "brutalism", 68.0f }, { "binDensity", 64.0f }, { "cluster", 4.0f }, { "freezeRate", 42.0f }, { "freezeLen", 380.0f }, { "phaseScramble", 66.0f }, { "phaseSteps", 8.0f }, { "sortAmount", 60.0f }, { "jitter", 30.0f }, { "stereoLink", 0.0f }, { "mix", 80.0f }, { "autolevel", 37.0f }, { "safety", 84.0f }, { "output", -4.2f } }),
+            makePreset("Extreme FFT Wreck", {{ "brutalism", 92.0f }, { "binDensity", 92.0f }, { "cluster", 5.0f }, { "freezeRate", 78.0f }, { "freezeLen", 700.0f }, { "phaseScramble", 94.0f }, { "phaseSteps", 4.0f }, { "sortAmount", 92.0f }, { "jitter", 62.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 32.0f }, { "safety", 90.0f }, { "output", -6.0f } }),
+            makePreset("Extreme Frozen Wall", {{ "brutalism", 98.0f }, { "binDensity", 100.0f }, { "cluster", 5.0f }, { "freezeRate", 96.0f }, { "freezeLen", 1100.0f }, { "phaseScramble", 100.0f }, { "phaseSteps", 2.0f }, { "sortAmount", 100.0f }, { "jitter", 78.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 30.0f }, { "safety", 92.0f }, { "output", -7.0f } }),
+            makePreset("Rhythmic Spectral Gate", {{ "brutalism", 74.0f }, { "binDensity", 70.0f }, { "cluster", 3.0f }, { "freezeRate", 54.0f }, { "freezeLen", 260.0f }, { "phaseScramble", 72.0f }, { "phaseSteps", 10.0f }, { "sortAmount", 66.0f }, { "jitter", 34.0f }, { "stereoLink", 0.0f }, { "mix", 84.0f }, { "autolevel", 35.0f }, { "safety", 86.0f }, { "output", -4.6f } }),
+            makePreset("Rhythmic Bin Shuffle", {{ "brutalism", 80.0f }, { "binDensity", 78.0f }, { "cluster", 4.0f }, { "freezeRate", 62.0f }, { "freezeLen", 320.0f }, { "phaseScramble", 80.0f }, { "phaseSteps", 6.0f }, { "sortAmount", 74.0f }, { "jitter", 42.0f }, { "stereoLink", 0.0f }, { "mix", 88.0f }, { "autolevel", 34.0f }, { "safety", 87.0f }, { "output", -5.0f } })
+        };
+    }
+    else if constexpr (PluginIndex == 7)
+    {
+        return std::array {
+            makePreset("Init", {{ "overclock", 4.0f }, { "sensitivity", 10.0f }, { "failureRate", 0.0f }, { "latencySpike", 0.0f }, { "desync", 0.0f }, { "thermal", 0.0f }, { "recovery", 80.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 74.0f }, { "output", -10.0f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "overclock", 26.0f }, { "sensitivity", 34.0f }, { "failureRate", 14.0f }, { "latencySpike", 12.0f }, { "desync", 10.0f }, { "thermal", 16.0f }, { "recovery", 72.0f }, { "stereoLink", 0.0f }, { "mix", 34.0f }, { "autolevel", 56.0f }, { "safety", 77.0f }, { "output", -2.3f } }),
+            makePreset("Subtle Drift CPU", {{ "overclock", 36.0f }, { "sensitivity", 44.0f }, { "failureRate", 22.0f }, { "latencySpike", 18.0f }, { "desync", 18.0f }, { "thermal", 24.0f }, { "recovery", 62.0f }, { "stereoLink", 0.0f }, { "mix", 50.0f }, { "autolevel", 54.0f }, { "safety", 77.0f }, { "output", -2.1f } }),
+            makePreset("Subtle Thread Pull", {{ "overclock", 42.0f }, { "sensitivity", 50.0f }, { "failureRate", 26.0f }, { "latencySpike", 24.0f }, { "desync", 30.0f }, { "thermal", 30.0f }, { "recovery", 58.0f }, { "stereoLink", 0.0f }, { "mix", 56.0f }, { "autolevel", 53.0f }, { "safety", 78.0f }, { "output", -2.3f } }),
+            makePreset("Medium Unstable Core", {{ "overclock", 60.0f }, { "sensitivity", 66.0f }, { "failureRate", 42.0f }, { "latencySpike", 40.0f }, { "desync", 42.0f }, { "thermal", 46.0f }, { "recovery", 46.0f }, { "stereoLink", 0.0f }, { "mix", 76.0f }, { "autolevel", 50.0f }, { "safety", 80.0f }, { "output", -2.8f } }),
+            makePreset("Medium Heat Bloom", {{ "overclock", 68.0f }, { "sensitivity", 72.0f }, { "failureRate", 48.0f }, { "latencySpike", 54.0f }, { "desync", 52.0f }, { "thermal", 62.0f }, { "recovery", 40.0f }, { "stereoLink", 0.0f }, { "mix", 80.0f }, { "autolevel", 49.0f }, { "safety", 81.0f }, { "output", -3.1f } }),
+            makePreset("Extreme Overheat", {{ "overclock", 94.0f }, { "sensitivity", 92.0f }, { "failureRate", 82.0f }, { "latencySpike", 78.0f }, { "desync", 82.0f }, { "thermal", 90.0f }, { "recovery", 20.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 88.0f }, { "output", -4.8f } }),
+            makePreset("Extreme Clock Loss", {{ "overclock", 100.0f }, { "sensitivity", 100.0f }, { "failureRate", 94.0f }, { "latencySpike", 92.0f }, { "desync", 96.0f }, { "thermal", 100.0f }, { "recovery", 10.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 90.0f }, { "output", -6.2f } }),
+            makePreset("Rhythmic Stall", {{ "overclock", 74.0f }, { "sensitivity", 78.0f }, { "failureRate", 58.0f }, { "latencySpike", 64.0f }, { "desync", 54.0f }, { "thermal", 56.0f }, { "recovery", 34.0f }, { "stereoLink", 0.0f }, { "mix", 84.0f }, { "autolevel", 47.0f }, { "safety", 83.0f }, { "output", -3.6f } }),
+            makePreset("Rhythmic Desync Pulse", {{ "overclock", 80.0f }, { "sensitivity", 84.0f }, { "failureRate", 64.0f }, { "latencySpike", 70.0f }, { "desync", 70.0f }, { "thermal", 64.0f }, { "recovery", 30.0f }, { "stereoLink", 0.0f }, { "mix", 88.0f }, { "autolevel", 46.0f }, { "safety", 84.0f }, { "output", -3.9f } })
+        };
+    }
+    else if constexpr (PluginIndex == 8)
+    {
+        return std::array {
+            makePreset("Init", {{ "determinism", 4.0f }, { "stateCount", 2.0f }, { "stateDwell", 1200.0f }, { "loopMs", 5.0f }, { "hashWindow", 1024.0f }, { "jumpRule", 0.0f }, { "memory", 0.0f }, { "mix", 100.0f }, { "autolevel", 48.0f }, { "safety", 63.0f }, { "output", -16.1f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "determinism", 24.0f }, { "stateCount", 8.0f }, { "stateDwell", 380.0f }, { "loopMs", 16.0f }, { "hashWindow", 240.0f }, { "jumpRule", 1.0f }, { "memory", 24.0f }, { "mix", 36.0f }, { "autolevel", 54.0f }, { "safety", 68.0f }, { "output", -1.6f } }),
+            makePreset("Subtle Robot Grain", {{ "determinism", 34.0f }, { "stateCount", 14.0f }, { "stateDwell", 300.0f }, { "loopMs", 20.0f }, { "hashWindow", 200.0f }, { "jumpRule", 1.0f }, { "memory", 34.0f }, { "mix", 52.0f }, { "autolevel", 52.0f }, { "safety", 67.0f }, { "output", -1.4f } }),
+            makePreset("Subtle Loop Grid", {{ "determinism", 40.0f }, { "stateCount", 18.0f }, { "stateDwell", 240.0f }, { "loopMs", 24.0f }, { "hashWindow", 160.0f }, { "jumpRule", 0.0f }, { "memory", 44.0f }, { "mix", 58.0f }, { "autolevel", 51.0f }, { "safety", 68.0f }, { "output", -1.5f } }),
+            makePreset("Medium Finite Groove", {{ "determinism", 60.0f }, { "stateCount", 24.0f }, { "stateDwell", 180.0f }, { "loopMs", 30.0f }, { "hashWindow", 120.0f }, { "jumpRule", 1.0f }, { "memory", 48.0f }, { "mix", 76.0f }, { "autolevel", 49.0f }, { "safety", 70.0f }, { "output", -1.9f } }),
+            makePreset("Medium Hash Runner", {{ "determinism", 66.0f }, { "stateCount", 36.0f }, { "stateDwell", 120.0f }, { "loopMs", 34.0f }, { "hashWindow", 96.0f }, { "jumpRule", 1.0f }, { "memory", 54.0f }, { "mix", 80.0f }, { "autolevel", 48.0f }, { "safety", 71.0f }, { "output", -2.1f } }),
+            makePreset("Extreme Determinator", {{ "determinism", 92.0f }, { "stateCount", 96.0f }, { "stateDwell", 50.0f }, { "loopMs", 50.0f }, { "hashWindow", 40.0f }, { "jumpRule", 1.0f }, { "memory", 74.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 77.0f }, { "output", -3.6f } }),
+            makePreset("Extreme State Prison", {{ "determinism", 98.0f }, { "stateCount", 128.0f }, { "stateDwell", 20.0f }, { "loopMs", 60.0f }, { "hashWindow", 8.0f }, { "jumpRule", 2.0f }, { "memory", 88.0f }, { "mix", 100.0f }, { "autolevel", 39.0f }, { "safety", 80.0f }, { "output", -4.8f } }),
+            makePreset("Rhythmic Loop Grid", {{ "determinism", 74.0f }, { "stateCount", 40.0f }, { "stateDwell", 90.0f }, { "loopMs", 36.0f }, { "hashWindow", 72.0f }, { "jumpRule", 0.0f }, { "memory", 58.0f }, { "mix", 84.0f }, { "autolevel", 46.0f }, { "safety", 73.0f }, { "output", -2.5f } }),
+            makePreset("Rhythmic Hash Pulse", {{ "determinism", 80.0f }, { "stateCount", 52.0f }, { "stateDwell", 70.0f }, { "loopMs", 40.0f }, { "hashWindow", 56.0f }, { "jumpRule", 1.0f }, { "memory", 64.0f }, { "mix", 88.0f }, { "autolevel", 45.0f }, { "safety", 74.0f }, { "output", -2.8f } })
+        };
+    }
+    else if constexpr (PluginIndex == 9)
+    {
+        return std::array {
+            makePreset("Init", {{ "amount", 28.0f }, { "rateHz", 4.5f }, { "sliceMs", 36.0f }, { "repeats", 3.0f }, { "reverse", 6.0f }, { "timingJitter", 4.0f }, { "duck", 22.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 66.0f }, { "output", -10.0f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "amount", 36.0f }, { "rateHz", 5.2f }, { "sliceMs", 42.0f }, { "repeats", 4.0f }, { "reverse", 10.0f }, { "timingJitter", 8.0f }, { "duck", 28.0f }, { "stereoLink", 0.0f }, { "mix", 32.0f }, { "autolevel", 54.0f }, { "safety", 71.0f }, { "output", -1.6f } }),
+            makePreset("Subtle Tape Twitch", {{ "amount", 40.0f }, { "rateHz", 4.0f }, { "sliceMs", 48.0f }, { "repeats", 3.0f }, { "reverse", 12.0f }, { "timingJitter", 10.0f }, { "duck", 24.0f }, { "stereoLink", 0.0f }, { "mix", 48.0f }, { "autolevel", 53.0f }, { "safety", 70.0f }, { "output", -1.5f } }),
+            makePreset("Subtle Chop Drift", {{ "amount", 44.0f }, { "rateHz", 6.2f }, { "sliceMs", 30.0f }, { "repeats", 4.0f }, { "reverse", 18.0f }, { "timingJitter", 14.0f }, { "duck", 30.0f }, { "stereoLink", 0.0f }, { "mix", 52.0f }, { "autolevel", 52.0f }, { "safety", 70.0f }, { "output", -1.6f } }),
+            makePreset("Medium Gate Repeat", {{ "amount", 62.0f }, { "rateHz", 8.0f }, { "sliceMs", 24.0f }, { "repeats", 6.0f }, { "reverse", 20.0f }, { "timingJitter", 16.0f }, { "duck", 42.0f }, { "stereoLink", 0.0f }, { "mix", 74.0f }, { "autolevel", 50.0f }, { "safety", 73.0f }, { "output", -2.2f } }),
+            makePreset("Medium Vinyl Skip", {{ "amount", 68.0f }, { "rateHz", 10.0f }, { "sliceMs", 18.0f }, { "repeats", 7.0f }, { "reverse", 30.0f }, { "timingJitter", 24.0f }, { "duck", 48.0f }, { "stereoLink", 0.0f }, { "mix", 78.0f }, { "autolevel", 49.0f }, { "safety", 74.0f }, { "output", -2.4f } }),
+            makePreset("Extreme Machine Gun", {{ "amount", 92.0f }, { "rateHz", 16.0f }, { "sliceMs", 12.0f }, { "repeats", 12.0f }, { "reverse", 24.0f }, { "timingJitter", 20.0f }, { "duck", 64.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 45.0f }, { "safety", 80.0f }, { "output", -3.2f } }),
+            makePreset("Extreme Reverse Shred", {{ "amount", 96.0f }, { "rateHz", 14.0f }, { "sliceMs", 14.0f }, { "repeats", 14.0f }, { "reverse", 86.0f }, { "timingJitter", 28.0f }, { "duck", 72.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 43.0f }, { "safety", 82.0f }, { "output", -3.8f } }),
+            makePreset("Rhythmic 16th Chop", {{ "amount", 78.0f }, { "rateHz", 8.0f }, { "sliceMs", 22.0f }, { "repeats", 8.0f }, { "reverse", 14.0f }, { "timingJitter", 8.0f }, { "duck", 52.0f }, { "stereoLink", 0.0f }, { "mix", 84.0f }, { "autolevel", 48.0f }, { "safety", 76.0f }, { "output", -2.6f } }),
+            makePreset("Rhythmic Triplet Jam", {{ "amount", 82.0f }, { "rateHz", 6.0f }, { "sliceMs", 28.0f }, { "repeats", 9.0f }, { "reverse", 22.0f }, { "timingJitter", 12.0f }, { "duck", 56.0f }, { "stereoLink", 0.0f }, { "mix", 86.0f }, { "autolevel", 47.0f }, { "safety", 77.0f }, { "output", -2.8f } })
+        };
+    }
+    else if constexpr (PluginIndex == 10)
+    {
+        return std::array {
+            makePreset("Init", {{ "skip", 80.0f }, { "jumpRate", 3.8f }, { "segMs", 220.0f }, { "melody", 60.0f }, { "spread", 72.0f }, { "reverse", 34.0f }, { "flutter", 46.0f }, { "blur", 14.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 47.0f }, { "safety", 68.0f }, { "output", -10.7f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "skip", 42.0f }, { "jumpRate", 4.8f }, { "segMs", 46.0f }, { "melody", 46.0f }, { "spread", 44.0f }, { "reverse", 14.0f }, { "flutter", 12.0f }, { "blur", 24.0f }, { "stereoLink", 0.0f }, { "mix", 30.0f }, { "autolevel", 52.0f }, { "safety", 71.0f }, { "output", -1.8f } }),
+            makePreset("Subtle Disk Fray", {{ "skip", 48.0f }, { "jumpRate", 5.6f }, { "segMs", 34.0f }, { "melody", 52.0f }, { "spread", 42.0f }, { "reverse", 16.0f }, { "flutter", 16.0f }, { "blur", 26.0f }, { "stereoLink", 0.0f }, { "mix", 46.0f }, { "autolevel", 50.0f }, { "safety", 72.0f }, { "output", -1.7f } }),
+            makePreset("Subtle Pitch Skips", {{ "skip", 54.0f }, { "jumpRate", 6.2f }, { "segMs", 30.0f }, { "melody", 62.0f }, { "spread", 58.0f }, { "reverse", 18.0f }, { "flutter", 20.0f }, { "blur", 28.0f }, { "stereoLink", 0.0f }, { "mix", 52.0f }, { "autolevel", 49.0f }, { "safety", 72.0f }, { "output", -1.9f } }),
+            makePreset("Medium Oval Cutups", {{ "skip", 68.0f }, { "jumpRate", 7.8f }, { "segMs", 24.0f }, { "melody", 72.0f }, { "spread", 68.0f }, { "reverse", 22.0f }, { "flutter", 24.0f }, { "blur", 34.0f }, { "stereoLink", 0.0f }, { "mix", 74.0f }, { "autolevel", 47.0f }, { "safety", 74.0f }, { "output", -2.4f } }),
+            makePreset("Medium Overcomes Drift", {{ "skip", 74.0f }, { "jumpRate", 8.5f }, { "segMs", 22.0f }, { "melody", 80.0f }, { "spread", 76.0f }, { "reverse", 26.0f }, { "flutter", 30.0f }, { "blur", 36.0f }, { "stereoLink", 0.0f }, { "mix", 78.0f }, { "autolevel", 46.0f }, { "safety", 75.0f }, { "output", -2.6f } }),
+            makePreset("Extreme CD Collapse", {{ "skip", 94.0f }, { "jumpRate", 12.0f }, { "segMs", 16.0f }, { "melody", 92.0f }, { "spread", 88.0f }, { "reverse", 34.0f }, { "flutter", 42.0f }, { "blur", 44.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 80.0f }, { "output", -3.4f } }),
+            makePreset("Extreme Melodic Shatter", {{ "skip", 98.0f }, { "jumpRate", 14.5f }, { "segMs", 12.0f }, { "melody", 100.0f }, { "spread", 96.0f }, { "reverse", 52.0f }, { "flutter", 52.0f }, { "blur", 48.0f }, { "stereoLink", 0.0f }, { "mix", 100.0f }, { "autolevel", 40.0f }, { "safety", 83.0f }, { "output", -3.9f } }),
+            makePreset("Rhythmic Quarter Skip", {{ "skip", 76.0f }, { "jumpRate", 4.0f }, { "segMs", 36.0f }, { "melody", 70.0f }, { "spread", 64.0f }, { "reverse", 16.0f }, { "flutter", 20.0f }, { "blur", 30.0f }, { "stereoLink", 0.0f }, { "mix", 82.0f }, { "autolevel", 45.0f }, { "safety", 77.0f }, { "output", -2.8f } }),
+            makePreset("Rhythmic Trip Skipline", {{ "skip", 82.0f }, { "jumpRate", 6.0f }, { "segMs", 26.0f }, { "melody", 84.0f }, { "spread", 78.0f }, { "reverse", 24.0f }, { "flutter", 28.0f }, { "blur", 34.0f }, { "stereoLink", 0.0f }, { "mix", 86.0f }, { "autolevel", 44.0f }, { "safety", 78.0f }, { "output", -3.0f } })
+        };
+    }
+    else if constexpr (PluginIndex == kChainPluginIndex)
+    {
+        return std::array {
+            makePreset("Init", {{ "collapse", 5.0f }, { "mantissaBits", 23.0f }, { "exponentStep", 1.0f }, { "temporalHold", 0.0f }, { "blockSize", 0.0f }, { "quantCurve", 0.0f }, { "rounding", 0.0f }, { "denormal", 0.0f }, { "stress", 4.0f }, { "baseBlock", 2.0f }, { "blockJitter", 0.0f }, { "seam", 0.0f }, { "tailDrop", 0.0f }, { "reorder", 0.0f }, { "lookFail", 0.0f }, { "artifact", 4.0f }, { "bitrate", 320.0f }, { "masking", 0.0f }, { "smear", 0.0f }, { "codecMode", 0.0f }, { "switchMs", 400.0f }, { "packetLoss", 0.0f }, { "burst", 0.0f }, { "preecho", 0.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 74.0f }, { "output", -10.4f }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }),
+            makePreset("Safe Mix", {{ "collapse", 22.0f }, { "mantissaBits", 16.0f }, { "exponentStep", 2.0f }, { "temporalHold", 2.0f }, { "blockSize", 2.0f }, { "quantCurve", 2.0f }, { "rounding", 8.0f }, { "denormal", 2.0f }, { "stress", 25.0f }, { "baseBlock", 2.0f }, { "blockJitter", 25.0f }, { "seam", 15.0f }, { "tailDrop", 8.0f }, { "reorder", 12.0f }, { "lookFail", 10.0f }, { "artifact", 24.0f }, { "bitrate", 160.0f }, { "masking", 24.0f }, { "smear", 18.0f }, { "codecMode", 1.0f }, { "switchMs", 360.0f }, { "packetLoss", 8.0f }, { "burst", 16.0f }, { "preecho", 10.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 30.0f }, { "autolevel", 56.0f }, { "safety", 76.0f }, { "output", -2.6f } }),
+            makePreset("Subtle Worn Stream", {{ "collapse", 30.0f }, { "mantissaBits", 14.0f }, { "exponentStep", 2.0f }, { "temporalHold", 2.0f }, { "blockSize", 2.0f }, { "quantCurve", 1.0f }, { "rounding", 12.0f }, { "denormal", 2.0f }, { "stress", 34.0f }, { "baseBlock", 2.0f }, { "blockJitter", 36.0f }, { "seam", 24.0f }, { "tailDrop", 10.0f }, { "reorder", 18.0f }, { "lookFail", 14.0f }, { "artifact", 34.0f }, { "bitrate", 128.0f }, { "masking", 34.0f }, { "smear", 28.0f }, { "codecMode", 1.0f }, { "switchMs", 300.0f }, { "packetLoss", 12.0f }, { "burst", 24.0f }, { "preecho", 14.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 48.0f }, { "autolevel", 53.0f }, { "safety", 76.0f }, { "output", -2.4f } }),
+            makePreset("Subtle Bit Packets", {{ "collapse", 35.0f }, { "mantissaBits", 12.0f }, { "exponentStep", 3.0f }, { "temporalHold", 3.0f }, { "blockSize", 3.0f }, { "quantCurve", 2.0f }, { "rounding", 15.0f }, { "denormal", 4.0f }, { "stress", 38.0f }, { "baseBlock", 3.0f }, { "blockJitter", 32.0f }, { "seam", 30.0f }, { "tailDrop", 14.0f }, { "reorder", 24.0f }, { "lookFail", 18.0f }, { "artifact", 40.0f }, { "bitrate", 112.0f }, { "masking", 42.0f }, { "smear", 36.0f }, { "codecMode", 2.0f }, { "switchMs", 240.0f }, { "packetLoss", 14.0f }, { "burst", 28.0f }, { "preecho", 18.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 54.0f }, { "autolevel", 52.0f }, { "safety", 77.0f }, { "output", -2.6f } }),
+            makePreset("Medium Float Into Codec", {{ "collapse", 55.0f }, { "mantissaBits", 10.0f }, { "exponentStep", 4.0f }, { "temporalHold", 3.0f }, { "blockSize", 4.0f }, { "quantCurve", 2.0f }, { "rounding", 24.0f }, { "denormal", 8.0f }, { "stress", 4.0f }, { "baseBlock", 2.0f }, { "blockJitter", 0.0f }, { "seam", 0.0f }, { "tailDrop", 0.0f }, { "reorder", 0.0f }, { "lookFail", 0.0f }, { "artifact", 58.0f }, { "bitrate", 84.0f }, { "masking", 62.0f }, { "smear", 50.0f }, { "codecMode", 1.0f }, { "switchMs", 200.0f }, { "packetLoss", 22.0f }, { "burst", 40.0f }, { "preecho", 28.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 1.0f }, { "sagBypass", 0.0f }, { "mix", 74.0f }, { "autolevel", 50.0f }, { "safety", 79.0f }, { "output", -3.2f } }),
+            makePreset("Medium Broken Pipeline", {{ "collapse", 60.0f }, { "mantissaBits", 9.0f }, { "exponentStep", 5.0f }, { "temporalHold", 4.0f }, { "blockSize", 4.0f }, { "quantCurve", 3.0f }, { "rounding", 30.0f }, { "denormal", 10.0f }, { "stress", 56.0f }, { "baseBlock", 1.0f }, { "blockJitter", 58.0f }, { "seam", 44.0f }, { "tailDrop", 28.0f }, { "reorder", 42.0f }, { "lookFail", 36.0f }, { "artifact", 58.0f }, { "bitrate", 84.0f }, { "masking", 62.0f }, { "smear", 50.0f }, { "codecMode", 1.0f }, { "switchMs", 200.0f }, { "packetLoss", 22.0f }, { "burst", 40.0f }, { "preecho", 28.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 78.0f }, { "autolevel", 49.0f }, { "safety", 80.0f }, { "output", -3.4f } }),
+            makePreset("Extreme Total Failure", {{ "collapse", 85.0f }, { "mantissaBits", 6.0f }, { "exponentStep", 9.0f }, { "temporalHold", 6.0f }, { "blockSize", 6.0f }, { "quantCurve", 3.0f }, { "rounding", 60.0f }, { "denormal", 25.0f }, { "stress", 90.0f }, { "baseBlock", 0.0f }, { "blockJitter", 95.0f }, { "seam", 88.0f }, { "tailDrop", 72.0f }, { "reorder", 86.0f }, { "lookFail", 78.0f }, { "artifact", 92.0f }, { "bitrate", 20.0f }, { "masking", 95.0f }, { "smear", 84.0f }, { "codecMode", 2.0f }, { "switchMs", 90.0f }, { "packetLoss", 72.0f }, { "burst", 90.0f }, { "preecho", 68.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 88.0f }, { "output", -5.4f } }),
+            makePreset("Extreme Signal Collapse", {{ "collapse", 95.0f }, { "mantissaBits", 4.0f }, { "exponentStep", 12.0f }, { "temporalHold", 7.0f }, { "blockSize", 7.0f }, { "quantCurve", 3.0f }, { "rounding", 80.0f }, { "denormal", 40.0f }, { "stress", 96.0f }, { "baseBlock", 0.0f }, { "blockJitter", 100.0f }, { "seam", 94.0f }, { "tailDrop", 84.0f }, { "reorder", 94.0f }, { "lookFail", 92.0f }, { "artifact", 98.0f }, { "bitrate", 8.0f }, { "masking", 100.0f }, { "smear", 96.0f }, { "codecMode", 2.0f }, { "switchMs", 60.0f }, { "packetLoss", 86.0f }, { "burst", 100.0f }, { "preecho", 84.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 90.0f }, { "output", -6.6f } }),
+            makePreset("Rhythmic Glitch Stream", {{ "collapse", 5.0f }, { "mantissaBits", 23.0f }, { "exponentStep", 1.0f }, { "temporalHold", 0.0f }, { "blockSize", 0.0f }, { "quantCurve", 0.0f }, { "rounding", 0.0f }, { "denormal", 0.0f }, { "stress", 70.0f }, { "baseBlock", 1.0f }, { "blockJitter", 72.0f }, { "seam", 50.0f }, { "tailDrop", 40.0f }, { "reorder", 62.0f }, { "lookFail", 50.0f }, { "artifact", 74.0f }, { "bitrate", 42.0f }, { "masking", 78.0f }, { "smear", 62.0f }, { "codecMode", 1.0f }, { "switchMs", 180.0f }, { "packetLoss", 44.0f }, { "burst", 70.0f }, { "preecho", 36.0f }, { "fpcBypass", 1.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 0.0f }, { "mix", 84.0f }, { "autolevel", 47.0f }, { "safety", 83.0f }, { "output", -3.8f } }),
+            makePreset("Rhythmic Stepped Frames", {{ "collapse", 70.0f }, { "mantissaBits", 8.0f }, { "exponentStep", 6.0f }, { "temporalHold", 5.0f }, { "blockSize", 4.0f }, { "quantCurve", 0.0f }, { "rounding", 35.0f }, { "denormal", 8.0f }, { "stress", 78.0f }, { "baseBlock", 0.0f }, { "blockJitter", 82.0f }, { "seam", 62.0f }, { "tailDrop", 52.0f }, { "reorder", 72.0f }, { "lookFail", 64.0f }, { "artifact", 4.0f }, { "bitrate", 320.0f }, { "masking", 0.0f }, { "smear", 0.0f }, { "codecMode", 0.0f }, { "switchMs", 400.0f }, { "packetLoss", 0.0f }, { "burst", 0.0f }, { "preecho", 0.0f }, { "fpcBypass", 0.0f }, { "bgeBypass", 0.0f }, { "sagBypass", 1.0f }, { "mix", 86.0f }, { "autolevel", 48.0f }, { "safety", 82.0f }, { "output", -3.6f } })
+        };
+    }
+    else
+    {
+        return std::array { makePreset("Init", {{ "digital", 0.0f }, { "mix", 100.0f }, { "autolevel", defaultAutoLevelPercent() }, { "safety", defaultSafetyPercent() }, { "output", defaultOutputTrimDb() }, { "limiter", 0.0f }, { "quality", 0.0f }, { "offlineThreads", 0.0f } }) };
+    }
+}
+
+constexpr auto kFactoryPresets = makeFactoryPresets<kPluginIndex>();
+
+constexpr bool presetCoversEveryParameter(const FactoryPreset& preset)
+{
+    for (int p = 0; p < kParameterIds.size; ++p)
+    {
+        auto found = false;
+        for (int i = 0; i < preset.numValues; ++i)
+            found = found || preset.values[(size_t) i].parameter == p;
+
+        if (! found)
+            return false;
+    }
+
+    return true;
+}
+
+static_assert(presetCoversEveryParameter(kFactoryPresets[0]), "the Init preset must set every parameter");
+
+// Parameter defaults are taken from the Init preset, so a new instance is already on program 0 and
+// the constructor has nothing to apply. IDs outside this plugin's layout belong to parameters that
+// are never created here and read as zero.
+consteval float initValue(std::string_view id)
+{
+    const auto index = kParameterIds.indexOf(id);
+
+    for (int i = 0; i < kFactoryPresets[0].numValues; ++i)
+        if (kFactoryPresets[0].values[(size_t) i].parameter == index)
+            return kFactoryPresets[0].values[(size_t) i].value;
+
+    return 0.0f;
+}
+
+consteval int initIndex(std::string_view id)
+{
+    return static_cast<int>(initValue(id));
+}
+
+// Catmull-Rom weights for a point t of the way from x1 to x2, given x0..x3.
+constexpr std::array<float, 4> catmullRomWeights(float t)
+{
+    return { 0.5f * (-t + 2.0f * t * t - t * t * t),
+             0.5f * (2.0f - 5.0f * t * t + 3.0f * t * t * t),
+             0.5f * (t + 4.0f * t * t - 3.0f * t * t * t),
+             0.5f * (-t * t + t * t * t) };
+}
+
+constexpr auto kQuarterWeights = catmullRomWeights(0.25f);
+constexpr auto kHalfWeights = catmullRomWeights(0.5f);
+
+// Largest magnitude at the three 4x-oversampled points between x1 and x2. Close enough to a
+// true-peak meter for limiting, at a fraction of the cost of a polyphase interpolator.
+float interSamplePeak(float x0, float x1, float x2, float x3)
+{
+    const auto& q = kQuarterWeights;
+    const auto quarter = q[0] * x0 + q[1] * x1 + q[2] * x2 + q[3] * x3;
+    const auto half = kHalfWeights[0] * (x0 + x3) + kHalfWeights[1] * (x1 + x2);
+    const auto threeQuarter = q[3] * x0 + q[2] * x1 + q[1] * x2 + q[0] * x3;
+    return juce::jmax(std::abs(quarter), std::abs(half), std::abs(threeQuarter));
+}
+}
+
+ChannelWorkers::~ChannelWorkers()
+{
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    wake.notify_all();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+bool ChannelWorkers::tryRun(int channelsToRun, Task taskToRun, void* taskContext)
+{
+    if (busy.exchange(true, std::memory_order_acquire))
+        return false;
+
+    // Only as many helpers as there are channels beyond the caller's own are woken; the rest sleep.
+    if (threads.empty())
+    {
+        const auto numHelpers = juce::jlimit(1, 7, juce::SystemStats::getNumCpus() - 1);
+        threads.reserve((size_t) numHelpers);
+        for (int i = 0; i < numHelpers; ++i)
+            threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        task = taskToRun;
+        context = taskContext;
+        numChannels = channelsToRun;
+        nextChannel.store(0, std::memory_order_relaxed);
+        helpersWanted = juce::jmin(static_cast<int>(threads.size()), channelsToRun - 1);
+        helpersFinished = 0;
+        ++generation;
+    }
+
+    wake.notify_all();
+    runClaimedChannels();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return helpersFinished == helpersWanted; });
+    }
+
+    busy.store(false, std::memory_order_release);
+    return true;
+}
+
+void ChannelWorkers::workerLoop(int index)
+{
+    std::uint64_t seenGeneration = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping)
+                return;
+
+            seenGeneration = generation;
+            if (index >= helpersWanted)
+                continue;
+        }
+
+        runClaimedChannels();
+
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            ++helpersFinished;
+        }
+
+        done.notify_one();
+    }
+}
+
+void ChannelWorkers::runClaimedChannels()
+{
+    for (auto channel = nextChannel.fetch_add(1, std::memory_order_relaxed); channel < numChannels;
+         channel = nextChannel.fetch_add(1, std::memory_order_relaxed))
+        task(context, channel);
+}
+
+DigitalisAudioProcessor::SharedTables::SharedTables()
+{
+    for (int i = 0; i < 2 * sagMdctSize; ++i)
+        mdctWindow[(size_t) i] = std::sin(juce::MathConstants<float>::pi * (static_cast<float>(i) + 0.5f) / static_cast<float>(2 * sagMdctSize));
+
+    for (int i = 0; i < sagMdctSize / 2; ++i)
+    {
+        const auto n = static_cast<double>(sagMdctSize);
+        mdctPreTwiddle[(size_t) i] = std::polar(1.0f, static_cast<float>(-juce::MathConstants<double>::pi * (i + 0.25) / n));
+        mdctPostTwiddle[(size_t) i] = std::polar(1.0f, static_cast<float>(-juce::MathConstants<double>::pi * i / n));
+    }
+
+    for (int i = 0; i < static_cast<int>(semitoneRatios.size()); ++i)
+        semitoneRatios[(size_t) i] = std::pow(2.0f, static_cast<float>(i - 24) / 12.0f);
+
+    // Blackman-windowed sinc, one row per fractional phase, each row normalised to unity gain.
+    constexpr auto taps = HistoryBuffer::sincTaps;
+    constexpr auto halfWidth = static_cast<double>(taps / 2);
+    for (int phase = 0; phase <= HistoryBuffer::sincPhases; ++phase)
+    {
+        const auto frac = static_cast<double>(phase) / HistoryBuffer::sincPhases;
+        auto* row = sincKernels.data() + phase * taps;
+        auto sum = 0.0;
+
+        for (int k = 0; k < taps; ++k)
+        {
+            const auto t = static_cast<double>(k - taps / 2 + 1) - frac;
+            const auto x = juce::MathConstants<double>::pi * t;
+            const auto sinc = std::abs(t) < 1.0e-9 ? 1.0 : std::sin(x) / x;
+            const auto w = 0.42 + 0.5 * std::cos(x / halfWidth) + 0.08 * std::cos(2.0 * x / halfWidth);
+            row[k] = static_cast<float>(sinc * w);
+            sum += row[k];
+        }
+
+        for (int k = 0; k < taps; ++k)
+            row[k] = static_cast<float>(row[k] / sum);
+    }
+
+    // Minimum-phase band-limited step (minBLEP): a Blackman-windowed sinc at 16x resolution is made
+    // minimum phase through its real cepstrum, integrated, and read back at whole samples. The four
+    // transforms are a radix-2 FFT in double over one twiddle table; the cepstrum needs the
+    // precision, which juce::dsp::FFT (float only) would not give.
+    {
+        constexpr int oversample = 16;
+        constexpr int zeroCrossings = 8;
+        constexpr int impulseLength = 2 * zeroCrossings * oversample + 1;
+        constexpr int size = 1024;
+
+        std::vector<std::complex<double>> twiddles((size_t) size / 2);
+        for (int k = 0; k < size / 2; ++k)
+            twiddles[(size_t) k] = std::polar(1.0, -juce::MathConstants<double>::twoPi * k / size);
+
+        const auto dft = [&](std::vector<std::complex<double>> data, bool inverse)
+        {
+            for (int i = 1, j = 0; i < size; ++i)
+            {
+                auto bit = size >> 1;
+                for (; (j & bit) != 0; bit >>= 1)
+                    j ^= bit;
+                j ^= bit;
+
+                if (i < j)
+                    std::swap(data[(size_t) i], data[(size_t) j]);
+            }
+
+            for (int length = 2; length <= size; length *= 2)
+            {
+                const auto half = length / 2;
+                const auto stride = size / length;
+
+                for (int start = 0; start < size; start += length)
+                {
+                    for (int k = 0; k < half; ++k)
+                    {
+                        const auto w = twiddles[(size_t) (k * stride)];
+                        const auto a = data[(size_t) (start + k)];
+                        const auto b = data[(size_t) (start + k + half)] * (inverse ? std::conj(w) : w);
+                        data[(size_t) (start + k)] = a + b;
+                        data[(size_t) (start + k + half)] = a - b;
+                    }
+                }
+            }
+
+            if (inverse)
+                for (auto& x : data)
+                    x /= static_cast<double>(size);
+
+            return data;
+        };
+
+        std::vector<std::complex<double>> work((size_t) size);
+        for (int n = 0; n < impulseLength; ++n)
+        {
+            const auto t = static_cast<double>(n - zeroCrossings * oversample) / oversample;
+            const auto x = juce::MathConstants<double>::pi * t;
+            const auto sinc = std::abs(t) < 1.0e-9 ? 1.0 : std::sin(x) / x;
+            const auto phase = juce::MathConstants<double>::twoPi * n / (impulseLength - 1);
+            work[(size_t) n] = sinc * (0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase));
+        }
+
+        auto spectrum = dft(work, false);
+        for (auto& bin : spectrum)
+            bin = std::log(juce::jmax(std::abs(bin), 1.0e-9));
+
+        // Fold the cepstrum onto positive quefrencies, which makes the spectrum minimum phase.
+        auto cepstrum = dft(spectrum, true);
+        for (int n = 1; n < size / 2; ++n)
+            cepstrum[(size_t) n] = 2.0 * cepstrum[(size_t) n].real();
+        for (int n = size / 2 + 1; n < size; ++n)
+            cepstrum[(size_t) n] = 0.0;
+        cepstrum[0] = cepstrum[0].real();
+        cepstrum[(size_t) size / 2] = cepstrum[(size_t) size / 2].real();
+
+        spectrum = dft(cepstrum, false);
+        for (auto& bin : spectrum)
+            bin = std::exp(bin);
+
+        const auto impulse = dft(spectrum, true);
+        auto total = 0.0;
+        for (const auto& h : impulse)
+            total += h.real();
+
+        auto integral = 0.0;
+        for (int n = 0; n < nyqBlepLength * oversample; ++n)
+        {
+            if (n % oversample == 0)
+            {
+                // The last few taps are faded so the residual tapers off instead of being cut.
+                const auto k = n / oversample;
+                const auto fade = k < nyqBlepLength - 4 ? 1.0 : 0.5 + 0.5 * std::cos(juce::MathConstants<double>::pi * (k - nyqBlepLength + 5) / 5.0);
+                stepResidual[(size_t) k] = static_cast<float>((integral / total - 1.0) * fade);
+            }
+
+            integral += impulse[(size_t) n].real();
+        }
+    }
 }
 
 DigitalisAudioProcessor::DigitalisAudioProcessor()
@@ -152,15 +781,30 @@ DigitalisAudioProcessor::DigitalisAudioProcessor()
                                       .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       parameters(*this, nullptr, "PARAMETERS", createParameterLayout())
 {
-    factoryPresets = createFactoryPresets();
-    applyFactoryPreset(0);
+    static_assert(kParameterIds.size <= maxParameters);
+
+    const auto& params = getParameters();
+    jassert(params.size() == kParameterIds.size);
+
+    for (int i = 0; i < kParameterIds.size; ++i)
+    {
+        jassert(dynamic_cast<juce::RangedAudioParameter*>(params[i]) != nullptr);
+        layoutParameters[(size_t) i] = static_cast<juce::RangedAudioParameter*>(params[i]);
+        jassert(layoutParameters[(size_t) i]->paramID == kParameterIds.ids[(size_t) i].data());
+    }
+
+    for (int i = 0; i < kParameterIds.size; ++i)
+    {
+        auto* parameter = layoutParameters[(size_t) kStateKeys[(size_t) i].parameter];
+        stateSlots[(size_t) i] = { kStateKeys[(size_t) i].idHash, parameter, parameters.getRawParameterValue(parameter->paramID) };
+    }
 }
 
 void DigitalisAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
     maxBlockSize = samplesPerBlock;
-    processedSamples = 0;
+    digitalis::kernels(); // select the vector kernels here rather than on the audio thread
 
     juce::dsp::ProcessSpec spec;
     spec.sampleRate = sampleRate;
@@ -168,14 +812,119 @@ void DigitalisAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     spec.numChannels = static_cast<juce::uint32>(juce::jmax(1, getTotalNumOutputChannels()));
 
     dryWet.prepare(spec);
-    dryWet.reset();
+
+    const auto runsCodec = (kPluginIndex == 5 || kPluginIndex == kChainPluginIndex);
+
+    // ~1.5 ms of limiter lookahead, whatever the sample rate, within the dry path's delay budget.
+    limiterRamp = juce::jlimit(8, limiterMaxLatencySamples - 1, static_cast<int>(std::round(0.0015 * sampleRate)));
+    for (auto& line : limiterDelay)
+        line.assign((size_t) limiterRamp + 1, 0.0f);
+    limiterPeakValues.assign((size_t) limiterRamp + 2, 0.0f);
+    limiterPeakTimes.assign((size_t) limiterRamp + 2, 0u);
+    limiterGainRing.assign((size_t) limiterRamp, 1.0f);
+    limiterActive = parameters.getRawParameterValue("limiter")->load() >= 0.5f;
+
+    qualityTier = selectQualityTier();
+
+    for (auto& channelRng : channelRandom)
+        channelRng.setSeed(random.nextInt64());
+
+    if (kPluginIndex == 2)
+    {
+        if (nyqOversampler == nullptr)
+            nyqOversampler = std::make_unique<juce::dsp::Oversampling<float>>(2, 1, juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true, true);
+
+        nyqOversampler->initProcessing((size_t) samplesPerBlock);
+        nyqLatency = static_cast<int>(nyqOversampler->getLatencyInSamples());
+        nyqFadeBuffer.setSize(2, samplesPerBlock);
+    }
+
+    for (auto& line : nyqAlignDelay)
+        line.assign((size_t) juce::jmax(1, nyqLatency), 0.0f);
+    nyqTier = qualityTier;
+
+    updateReportedLatency();
 
     auto loopSize = juce::jmax(32, static_cast<int>(0.03 * sampleRate));
     for (auto& buffer : microLoopBuffers)
-    {
         buffer.setSize(1, loopSize);
-        buffer.clear();
+
+    for (auto& chunk : bgePrevChunk)
+    {
+        chunk.assign((size_t) bgeMaxChunk, 0.0f);
+    }
+    bgeChunk.assign((size_t) bgeMaxChunk, 0.0f);
+    for (size_t c = 0; c < 2; ++c)
+    {
+        auto& scratch = sagScratch[c];
+        scratch.fold.assign((size_t) sagMdctSize, 0.0f);
+        scratch.coeffs.assign((size_t) sagMdctSize, 0.0f);
+        scratch.time.assign((size_t) (2 * sagMdctSize), 0.0f);
+        if (runsCodec && ! scratch.fft.has_value())
+            scratch.fft.emplace(sagMdctOrder);
+        scratch.fftIn.assign((size_t) (sagMdctSize / 2), juce::dsp::Complex<float>(0.0f, 0.0f));
+        scratch.fftOut.assign((size_t) (sagMdctSize / 2), juce::dsp::Complex<float>(0.0f, 0.0f));
+
+        sagFrameInput[c].assign((size_t) (2 * sagMdctSize), 0.0f);
+        sagFrameOutput[c].assign((size_t) sagMdctSize, 0.0f);
+        sagOverlap[c].assign((size_t) sagMdctSize, 0.0f);
+        sagLastCoeffs[c].assign((size_t) sagMdctSize, 0.0f);
+        sagPreEchoOut[c].assign((size_t) (sagPreEchoTaps + sagMdctSize), 0.0f);
+        sagPreEchoSource[c].assign((size_t) (sagPreEchoTaps + sagMdctSize), 0.0f);
+    }
+
+    // Critical-band layout for the codec's bit allocator, mapped onto MDCT bins at this sample rate.
+    constexpr std::array<float, sagMaxBands> bandEdgesHz { 100.0f, 200.0f, 300.0f, 400.0f, 510.0f, 630.0f, 770.0f, 920.0f, 1080.0f, 1270.0f, 1480.0f, 1720.0f, 2000.0f,
+                                                           2320.0f, 2700.0f, 3150.0f, 3700.0f, 4400.0f, 5300.0f, 6400.0f, 7700.0f, 9500.0f, 12000.0f, 15500.0f, 20500.0f };
+    sagBandEdges.fill(sagMdctSize);
+    sagBandEdges[0] = 0;
+    sagNumBands = 0;
+    for (const auto edgeHz : bandEdgesHz)
+    {
+        if (sagBandEdges[(size_t) sagNumBands] >= sagMdctSize)
+            break;
+
+        const auto bin = static_cast<int>(std::round(edgeHz / (0.5 * sampleRate) * sagMdctSize));
+        const auto previousEdge = sagBandEdges[(size_t) sagNumBands];
+        sagBandEdges[(size_t) ++sagNumBands] = juce::jlimit(previousEdge + 1, sagMdctSize, bin);
     }
+    sagBandEdges[(size_t) sagNumBands] = sagMdctSize;
+    for (auto& line : ocfDelayLine)
+    {
+        line.assign((size_t) juce::jmax(2048, static_cast<int>(currentSampleRate * 0.25)), 0.0f);
+    }
+    for (auto& loop : dmLoopBuffer)
+    {
+        loop.assign((size_t) juce::jmax(16, static_cast<int>(0.08 * currentSampleRate)), 0.0f);
+    }
+    const auto stutterMax = juce::jmax(256, static_cast<int>(0.5 * currentSampleRate));
+    for (auto& slice : stutterSliceBuffer)
+        slice.setSize(stutterMax);
+    const auto mskSize = juce::jmax(2048, static_cast<int>(2.5 * currentSampleRate));
+    for (auto& b : mskBuffer)
+        b.setSize(mskSize);
+    for (auto& index : mskJumpPoints)
+        index.prepare(currentSampleRate, mskSize);
+
+    clearState();
+}
+
+void DigitalisAudioProcessor::clearState()
+{
+    processedSamples = 0;
+    dryWet.reset();
+    resetLimiter();
+
+    if (nyqOversampler != nullptr)
+        nyqOversampler->reset();
+    nyqFadeBuffer.clear();
+    for (auto& line : nyqAlignDelay)
+        std::fill(line.begin(), line.end(), 0.0f);
+    nyqAlignPos = 0;
+    nyqFadePos = nyqFadeSamples;
+
+    for (auto& buffer : microLoopBuffers)
+        buffer.clear();
 
     heldSamples = { 0.0f, 0.0f };
     heldCountdown = { 0, 0 };
@@ -184,59 +933,68 @@ void DigitalisAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     microLoopWritePos = { 0, 0 };
     microLoopReadPos = { 0, 0 };
     denormalBurstRemaining = 0;
-    nyqHeldCurrent = { 0.0f, 0.0f };
-    nyqHeldPrevious = { 0.0f, 0.0f };
-    nyqHoldCounter = { 1, 1 };
-    nyqFeedbackState = { 0.0f, 0.0f };
-    nyqFeedbackToneState = { 0.0f, 0.0f };
-    nyqPhase = 0.0f;
-    nyqTransientEnv = 0.0f;
+    nyqState = {};
     for (auto& chunk : bgePrevChunk)
-    {
-        chunk.assign((size_t) juce::jmax(32, maxBlockSize), 0.0f);
-    }
+        std::fill(chunk.begin(), chunk.end(), 0.0f);
+    std::fill(bgeChunk.begin(), bgeChunk.end(), 0.0f);
     bgeEnvelope = { 0.0f, 0.0f };
     bgePrevChunkSize = 0;
     bgeHasPrevChunk = false;
     aqHeldAmp = { 1.0f, 1.0f };
     aqHeldCounter = { 1, 1 };
     aqLfoPhase = { 0.0f, juce::MathConstants<float>::pi * 0.5f };
-    sagToneState = { 0.0f, 0.0f };
+    aqBeatNextStep = { 0, 0 };
+    aqBeatJitter = { 0, 0 };
+    aqBeatExpectedPos = 0.0;
+    aqBeatFreePpq = 0.0;
+    aqBeatNeedsSync = true;
     sagSmearState = { 0.0f, 0.0f };
-    sagLastFrameSample = { 0.0f, 0.0f };
     sagTransientEnv = { 0.0f, 0.0f };
     sagCodec = 0;
     sagCodecCounter = 0;
     sagLossBurstRemaining = 0;
-    for (auto& frozen : fftBrutalistFrozenSpectrum)
+    sagFrameRemaining = sagMdctSize;
+    sagLostFrames = 0;
+    for (size_t c = 0; c < 2; ++c)
     {
-        frozen.assign((size_t) fftBrutalistSize, juce::dsp::Complex<float>(0.0f, 0.0f));
+        for (auto* frame : { &sagFrameInput[c], &sagFrameOutput[c], &sagOverlap[c], &sagLastCoeffs[c], &sagPreEchoOut[c], &sagPreEchoSource[c] })
+            std::fill(frame->begin(), frame->end(), 0.0f);
     }
     fftBrutalistFreezeRemaining = { 0, 0 };
+    fftBrutalistFreezeValue = { 0.0f, 0.0f };
+    fftBrutalistHeld = { 0.0f, 0.0f };
+    fftBrutalistHoldCounter = { 0, 0 };
+    fftBrutalistPhase = { 0.0f, 0.0f };
     for (auto& line : ocfDelayLine)
-    {
-        line.assign((size_t) juce::jmax(2048, static_cast<int>(currentSampleRate * 0.25)), 0.0f);
-    }
+        std::fill(line.begin(), line.end(), 0.0f);
     ocfDelayWritePos = { 0, 0 };
     ocfDelayReadOffset = { 1, 1 };
     ocfHoldValue = { 0.0f, 0.0f };
     ocfHoldRemaining = { 0, 0 };
+    // The right channel's LFOs start where the old shared sample clock put them: 31 samples of the
+    // slowest drift, 59 of flutter and 13 of scratch rub ahead of the left.
+    ocfDriftPhase = { 0.0f, 31.0f * 0.00007f };
     ocfThermalState = 0.0f;
     ocfStressEnv = 0.0f;
+    ocfControlEnergy = 0.0f;
+    ocfControlCountdown = controlBlockSize;
     for (auto& loop : dmLoopBuffer)
-    {
-        loop.assign((size_t) juce::jmax(64, static_cast<int>(0.06 * currentSampleRate)), 0.0f);
-    }
+        std::fill(loop.begin(), loop.end(), 0.0f);
+    dmLoopLength = 0;
     dmLoopWritePos = { 0, 0 };
     dmLoopReadPos = { 0, 0 };
     dmStateIndex = 0;
     dmSamplesToNextState = 0;
     dmHashCounter = 0;
-    dmHashState = 2166136261u;
+    seedHashLanes(dmHashLanes, 2166136261u);
     dmStateSmoother = 0.0f;
-    const auto stutterMax = juce::jmax(256, static_cast<int>(0.5 * currentSampleRate));
+    dmTableStateCount = 0;
+    dmCurve.fill(std::numeric_limits<float>::quiet_NaN());
+    dmCurveLo = static_cast<int>(dmCurve.size());
+    dmCurveHi = -1;
+    dmCurveState = -1;
     for (auto& slice : stutterSliceBuffer)
-        slice.assign((size_t) stutterMax, 0.0f);
+        slice.clear();
     stutterCapturePos = { 0, 0 };
     stutterPlayPos = { 0, 0 };
     stutterRepeatsRemaining = { 0, 0 };
@@ -244,24 +1002,42 @@ void DigitalisAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     stutterIsCapturing = { false, false };
     stutterIsPlaying = { false, false };
     stutterIsReverse = { false, false };
-    const auto mskSize = juce::jmax(2048, static_cast<int>(2.5 * currentSampleRate));
     for (auto& b : mskBuffer)
-        b.assign((size_t) mskSize, 0.0f);
+        b.clear();
+    for (auto& index : mskJumpPoints)
+        index.clear();
     mskWritePos = { 0, 0 };
     mskPlayPos = { 0.0f, 0.0f };
     mskRemaining = { 0, 0 };
     mskRate = { 1.0f, 1.0f };
     mskDirection = { 1, 1 };
     mskBlurState = { 0.0f, 0.0f };
+    mskFlutterPhase = { 0.0f, 59.0f * 0.0024f };
+    mskRubPhase = { 0.0f, 13.0f * 0.019f };
     postDcPrevInput = { 0.0f, 0.0f };
     postDcPrevOutput = { 0.0f, 0.0f };
     postAutoLevelGain = 1.0f;
+    postLevelMeanSquare = targetRmsForPlugin() * targetRmsForPlugin();
+    postControlSumSq = 0.0f;
+    postControlCountdown = controlBlockSize;
+    silentInputSamples = 0;
+    lastOutputPeak = 0.0f;
 }
 
 void DigitalisAudioProcessor::releaseResources()
 {
 }
 
+void DigitalisAudioProcessor::reset()
+{
+    // Hosts call this from the audio thread (the VST3 wrapper on every setProcessing(false)), so it
+    // only clears the DSP state. A new rate or block size goes through prepareToPlay.
+   #if DIGITALIS_RT_SANITIZER
+    const digitalis::RealtimeScope realtimeScope;
+   #endif
+    clearState();
+}
+
 bool DigitalisAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 {
     const auto inSet = layouts.getMainInputChannelSet();
@@ -280,7 +1056,12 @@ bool DigitalisAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts)
 
 void DigitalisAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
 {
+   #if DIGITALIS_FLUSH_DENORMALS
     juce::ScopedNoDenormals noDenormals;
+   #endif
+   #if DIGITALIS_RT_SANITIZER
+    const digitalis::RealtimeScope realtimeScope;
+   #endif
 
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -289,110 +1070,64 @@ void DigitalisAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    auto* mixAmount = parameters.getRawParameterValue("mix");
+    // A NaN or Inf from upstream would latch in every filter and feedback path it reaches, and the
+    // dry path would pass it on. It becomes silence here instead.
+    for (auto ch = 0; ch < totalNumInputChannels; ++ch)
+        digitalis::flushNonFinite(buffer.getWritePointer(ch), buffer.getNumSamples());
+
+    auto* mixAmount = parameters.getRawParameterValue("mix");
+
+    if (const auto limiterOn = parameters.getRawParameterValue("limiter")->load() >= 0.5f; limiterOn != limiterActive)
+        setLimiterActive(limiterOn);
+
+    qualityTier = selectQualityTier();
+    channelThreadsActive = isNonRealtime() && buffer.getNumChannels() > 1
+                        && parameters.getRawParameterValue("offlineThreads")->load() >= 0.5f;
+
+    if (shouldSleep(buffer))
+    {
+        buffer.clear();
+        processedSamples = (processedSamples + buffer.getNumSamples()) & 0xffffff;
+        return;
+    }
 
     const auto wet = juce::jlimit(0.0f, 1.0f, *mixAmount * 0.01f);
     dryWet.setWetMixProportion(wet);
     dryWet.pushDrySamples(juce::dsp::AudioBlock<float>(buffer));
 
-    if (kPluginIndex == 1)
-    {
-        processFloatingPointCollapse(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 2)
-    {
-        processNyquistDestroyer(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 3)
-    {
-        processBufferGlitchEngine(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 4)
-    {
-        processAutomationQuantiser(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 5)
-    {
-        processStreamingArtifactGenerator(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 6)
-    {
-        processFFTBrutalist(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 7)
-    {
-        processOverclockFailure(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 8)
-    {
-        processDeterministicMachine(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 9)
-    {
-        processClassicBufferStutter(buffer);
-        applyPostSafety(buffer);
-        dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
-        if (monoToStereo)
-            for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
-                buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
-        return;
-    }
-    if (kPluginIndex == 10)
+    if (kPluginIndex >= 1 && kPluginIndex <= kChainPluginIndex)
     {
-        processMelodicSkippingEngine(buffer);
+        if (kPluginIndex == kChainPluginIndex)
+        {
+            // Bypassed slots are skipped outright rather than processed and discarded. The codec
+            // slot still runs its delay line so the reported latency holds either way.
+            for (const auto& slot : kChainSlots)
+            {
+                if (parameters.getRawParameterValue(slot.bypassId)->load() < 0.5f)
+                    processEngine(slot.engine, buffer);
+                else if (slot.engine == 5)
+                    processStreamingArtifactGenerator(buffer, false);
+            }
+        }
+        else
+        {
+            processEngine(kPluginIndex, buffer);
+        }
+
         applyPostSafety(buffer);
         dryWet.mixWetSamples(juce::dsp::AudioBlock<float>(buffer));
         if (monoToStereo)
             for (auto ch = 1; ch < totalNumOutputChannels; ++ch)
                 buffer.copyFrom(ch, 0, buffer, 0, 0, buffer.getNumSamples());
+
+        // The output level only matters once the input has gone quiet: it tells shouldSleep when
+        // the tail has actually played out.
+        if (silentInputSamples > 0)
+            lastOutputPeak = buffer.getMagnitude(0, buffer.getNumSamples());
+
+        // Running sample clock for the FFT Brutalist freeze grid. Wrapped at 2^24, a multiple of
+        // the grid, so it never overflows and the grid never slips.
+        processedSamples = (processedSamples + buffer.getNumSamples()) & 0xffffff;
         return;
     }
 
@@ -429,12 +1164,13 @@ void DigitalisAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
 
 juce::AudioProcessorEditor* DigitalisAudioProcessor::createEditor()
 {
-    return new DigitalisAudioProcessorEditor(*this);
+    const auto factory = editorFactory.load();
+    return factory != nullptr ? factory(*this) : nullptr;
 }
 
 bool DigitalisAudioProcessor::hasEditor() const
 {
-    return true;
+    return editorFactory.load() != nullptr;
 }
 
 const juce::String DigitalisAudioProcessor::getName() const
@@ -459,12 +1195,45 @@ bool DigitalisAudioProcessor::isMidiEffect() const
 
 double DigitalisAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // Latency is reported separately, so this only covers what keeps sounding after the input stops.
+    // Counted in double: a loop gain just under unity takes more steps than an int holds.
+    auto tail = 0.0;
+
+    if (kPluginIndex == kChainPluginIndex)
+    {
+        for (const auto& slot : kChainSlots)
+            if (parameters.getRawParameterValue(slot.bypassId)->load() < 0.5f)
+                tail += engineMemorySamples(slot.engine);
+    }
+    else
+    {
+        tail = engineMemorySamples(kPluginIndex);
+    }
+
+    if (kPluginIndex == 2)
+    {
+        // Small-signal gain around the Nyquist feedback loop. At or above unity the loop latches
+        // instead of dying away, so the tail is as long as the host will take.
+        const auto destroy = parameters.getRawParameterValue("destroy")->load() * 0.01f;
+        const auto feedback = parameters.getRawParameterValue("feedback")->load() * 0.01f;
+        const auto feedbackTone = parameters.getRawParameterValue("fbTone")->load() * 0.01f;
+        const auto loopGain = feedback * juce::jmap(destroy, 1.0f, 2.6f) * juce::jmap(destroy, 1.0f, 1.8f);
+
+        if (loopGain >= 1.0f)
+            return kMaxTailSeconds;
+
+        // Each pass round the loop takes up to one held step plus the tone filter's time constant.
+        const auto pass = juce::jmax(2, static_cast<int>(currentSampleRate / 600.0))
+                        + static_cast<int>(1.0f / juce::jmap(feedbackTone, 0.015f, 0.65f));
+        tail += static_cast<double>(decaySteps(loopGain)) * pass;
+    }
+
+    return juce::jmin(tail / currentSampleRate, kMaxTailSeconds);
 }
 
 int DigitalisAudioProcessor::getNumPrograms()
 {
-    return juce::jmax(1, static_cast<int>(factoryPresets.size()));
+    return static_cast<int>(kFactoryPresets.size());
 }
 
 int DigitalisAudioProcessor::getCurrentProgram()
@@ -480,7 +1249,7 @@ void DigitalisAudioProcessor::setCurrentProgram(int index)
 const juce::String DigitalisAudioProcessor::getProgramName(int index)
 {
     const auto clamped = juce::jlimit(0, getNumPrograms() - 1, index);
-    return factoryPresets.empty() ? juce::String("Init") : juce::String(factoryPresets[(size_t) clamped].name);
+    return kFactoryPresets[(size_t) clamped].name;
 }
 
 void DigitalisAudioProcessor::changeProgramName(int, const juce::String&)
@@ -489,13 +1258,50 @@ void DigitalisAudioProcessor::changeProgramName(int, const juce::String&)
 
 void DigitalisAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = parameters.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    juce::MemoryOutputStream stream(destData, false);
+    stream.writeInt(kStateMagic);
+    stream.writeShort(kStateVersion);
+    stream.writeShort(static_cast<short>(kPluginIndex));
+    stream.writeInt(currentProgramIndex);
+    stream.writeInt(kParameterIds.size);
+
+    for (int i = 0; i < kParameterIds.size; ++i)
+    {
+        const auto& slot = stateSlots[(size_t) i];
+        stream.writeInt(static_cast<int>(slot.idHash));
+        stream.writeFloat(slot.value->load());
+    }
 }
 
 void DigitalisAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    juce::MemoryInputStream stream(data, static_cast<size_t>(juce::jmax(0, sizeInBytes)), false);
+
+    if (sizeInBytes >= kStateHeaderSize && stream.readInt() == kStateMagic)
+    {
+        const auto version = stream.readShort();
+        stream.readShort(); // plugin index, informational only
+        const auto program = stream.readInt();
+        const auto count = stream.readInt();
+
+        if (version > kStateVersion || count < 0 || count > (sizeInBytes - kStateHeaderSize) / kStateRecordSize)
+            return;
+
+        // IDs that no longer exist are skipped; parameters missing from the state keep their value.
+        for (int i = 0; i < count; ++i)
+        {
+            const auto idHash = static_cast<std::uint32_t>(stream.readInt());
+            const auto value = stream.readFloat();
+            if (std::isfinite(value))
+                queueParameterValue(idHash, value);
+        }
+
+        flushParameterValues();
+        currentProgramIndex = juce::jlimit(0, getNumPrograms() - 1, program);
+        return;
+    }
+
+    // Sessions saved before the binary layout carry the APVTS tree as XML.
     std::unique_ptr<juce::XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
 
     if (xmlState != nullptr)
@@ -503,367 +1309,644 @@ void DigitalisAudioProcessor::setStateInformation(const void* data, int sizeInBy
             parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 }
 
+const DigitalisAudioProcessor::StateSlot* DigitalisAudioProcessor::findStateSlot(std::uint32_t idHash) const
+{
+    const auto end = stateSlots.begin() + kParameterIds.size;
+    const auto it = std::lower_bound(stateSlots.begin(), end, idHash, [](const auto& slot, auto hash) { return slot.idHash < hash; });
+    return (it != end && it->idHash == idHash) ? &*it : nullptr;
+}
+
+void DigitalisAudioProcessor::queueParameterValue(std::uint32_t idHash, float value)
+{
+    if (const auto* slot = findStateSlot(idHash))
+        queueParameterValue(*slot->parameter, value);
+}
+
+void DigitalisAudioProcessor::queueParameterValue(juce::RangedAudioParameter& parameter, float value)
+{
+    const auto normalised = parameter.convertTo0to1(value);
+    if (! juce::approximatelyEqual(normalised, parameter.getValue()) && numPendingValues < maxParameters)
+        pendingValues[(size_t) numPendingValues++] = { &parameter, normalised };
+}
+
+// Applies every queued value in one pass once they have all been resolved. Unchanged parameters
+// were already dropped while queueing, so recalling a preset or session only notifies the host
+// about what actually moves. No change gestures: a recall is not a user edit, and a preset change
+// reaches the host as a program change instead.
+void DigitalisAudioProcessor::flushParameterValues()
+{
+    for (const auto& pending : std::span(pendingValues.data(), (size_t) numPendingValues))
+        pending.parameter->setValueNotifyingHost(pending.normalised);
+
+    numPendingValues = 0;
+}
+
+void DigitalisAudioProcessor::addEngineParameters(std::vector<std::unique_ptr<juce::RangedAudioParameter>>& params, int engine)
+{
+    if (engine == 1)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("collapse", "Collapse", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("collapse")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("mantissaBits", "Mantissa Bits", juce::NormalisableRange<float>(3.0f, 23.0f, 1.0f), initValue("mantissaBits")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("exponentStep", "Exponent Step", juce::NormalisableRange<float>(1.0f, 16.0f, 1.0f), initValue("exponentStep")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("temporalHold", "Temporal Hold", juce::StringArray { "1", "2", "4", "8", "16", "32", "64", "128" }, initIndex("temporalHold")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("blockSize", "Block Size", juce::StringArray { "8", "16", "32", "64", "128", "256", "512", "1024" }, initIndex("blockSize")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("quantCurve", "Quant Curve", juce::StringArray { "Uniform", "Log", "MuLaw", "Chaotic" }, initIndex("quantCurve")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("rounding", "Rounding Chaos", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("rounding")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("denormal", "Denormal Burst", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("denormal")));
+    }
+    else if (engine == 2)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("destroy", "Destroy", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("destroy")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("minSR", "Min SR", juce::NormalisableRange<float>(1000.0f, 48000.0f, 1.0f), initValue("minSR")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("maxSR", "Max SR", juce::NormalisableRange<float>(4000.0f, 96000.0f, 1.0f), initValue("maxSR")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("modRate", "SR Mod Rate", juce::NormalisableRange<float>(0.05f, 20.0f, 0.001f, 0.33f), initValue("modRate")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("modDepth", "SR Mod Depth", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("modDepth")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("interpErr", "Interp Error", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("interpErr")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("transient", "Transient SR Drop", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("transient")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("feedback", "Alias Feedback", juce::NormalisableRange<float>(0.0f, 95.0f, 0.01f), initValue("feedback")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("fbTone", "Feedback Tone", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("fbTone")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("aliasAmt", "Alias Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("aliasAmt")));
+    }
+    else if (engine == 3)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("stress", "Engine Stress", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("stress")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("baseBlock", "Base Block", juce::StringArray { "16", "32", "64", "128", "256", "512" }, initIndex("baseBlock")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("blockJitter", "Block Jitter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("blockJitter")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("seam", "Seam Error", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("seam")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("tailDrop", "Tail Drop", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("tailDrop")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("reorder", "Reorder", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("reorder")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("lookFail", "Lookahead Failure", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("lookFail")));
+    }
+    else if (engine == 4)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("brutal", "Brutalism", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("brutal")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("gridMode", "Grid Mode", juce::StringArray { "Block", "Samples", "Beat" }, initIndex("gridMode")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("stepDiv", "Step Division", juce::StringArray { "1", "2", "4", "8", "16", "32", "64", "128" }, initIndex("stepDiv")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("zipper", "Zipper Tone", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("zipper")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("levels", "Envelope Levels", juce::NormalisableRange<float>(2.0f, 64.0f, 1.0f), initValue("levels")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("phaseLock", "Phase Lock", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("phaseLock")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("jitter", "Human Error", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("jitter")));
+    }
+    else if (engine == 5)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("artifact", "Artifact", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("artifact")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("bitrate", "Target Bitrate", juce::NormalisableRange<float>(8.0f, 320.0f, 1.0f), initValue("bitrate")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("masking", "Masking Aggression", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("masking")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("smear", "Smear Time", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("smear")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("codecMode", "Codec Mode", juce::StringArray { "Fixed MP3", "Cycle", "Random" }, initIndex("codecMode")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("switchMs", "Switch Rate", juce::NormalisableRange<float>(40.0f, 1200.0f, 1.0f), initValue("switchMs")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("packetLoss", "Packet Loss", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("packetLoss")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("burst", "Burstiness", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("burst")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("preecho", "Pre Echo", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("preecho")));
+    }
+    else if (engine == 6)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("brutalism", "Brutalism", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("brutalism")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("binDensity", "Bin Density", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("binDensity")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("cluster", "Cluster Size", juce::StringArray { "1", "2", "4", "8", "16", "32" }, initIndex("cluster")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("freezeRate", "Freeze Rate", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("freezeRate")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("freezeLen", "Freeze Length", juce::NormalisableRange<float>(10.0f, 1200.0f, 1.0f), initValue("freezeLen")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("phaseScramble", "Phase Scramble", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("phaseScramble")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("phaseSteps", "Phase Steps", juce::NormalisableRange<float>(2.0f, 64.0f, 1.0f), initValue("phaseSteps")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("sortAmount", "Sort Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("sortAmount")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("jitter", "Spectral Jitter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("jitter")));
+        params.push_back(std::make_unique<juce::AudioParameterBool>("stereoLink", "Stereo Link", initValue("stereoLink") >= 0.5f));
+    }
+    else if (engine == 7)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("overclock", "Overclock", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("overclock")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("sensitivity", "Stress Sensitivity", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("sensitivity")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("failureRate", "Failure Rate", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("failureRate")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("latencySpike", "Latency Spike", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("latencySpike")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("desync", "L R Desync", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("desync")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("thermal", "Thermal Drift", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("thermal")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("recovery", "Recovery", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("recovery")));
+        params.push_back(std::make_unique<juce::AudioParameterBool>("stereoLink", "Stereo Link", initValue("stereoLink") >= 0.5f));
+    }
+    else if (engine == 8)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("determinism", "Determinism", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("determinism")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("stateCount", "State Count", juce::NormalisableRange<float>(2.0f, 128.0f, 1.0f), initValue("stateCount")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("stateDwell", "State Dwell", juce::NormalisableRange<float>(5.0f, 1200.0f, 1.0f), initValue("stateDwell")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("loopMs", "Micro Loop Length", juce::NormalisableRange<float>(5.0f, 60.0f, 0.1f), initValue("loopMs")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("hashWindow", "Hash Window", juce::NormalisableRange<float>(8.0f, 1024.0f, 1.0f), initValue("hashWindow")));
+        params.push_back(std::make_unique<juce::AudioParameterChoice>("jumpRule", "State Jump Rule", juce::StringArray { "Sequential", "Hash", "Threshold" }, initIndex("jumpRule")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("memory", "Memory", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("memory")));
+    }
+    else if (engine == 9)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("amount", "Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("amount")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("rateHz", "Stutter Rate", juce::NormalisableRange<float>(0.25f, 24.0f, 0.001f, 0.35f), initValue("rateHz")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("sliceMs", "Slice Length", juce::NormalisableRange<float>(10.0f, 250.0f, 0.1f, 0.4f), initValue("sliceMs")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("repeats", "Repeats", juce::NormalisableRange<float>(1.0f, 16.0f, 1.0f), initValue("repeats")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("reverse", "Reverse Chance", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("reverse")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("timingJitter", "Timing Jitter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("timingJitter")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("duck", "Dry Duck", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("duck")));
+        params.push_back(std::make_unique<juce::AudioParameterBool>("stereoLink", "Stereo Link", initValue("stereoLink") >= 0.5f));
+    }
+    else if (engine == 10)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("skip", "Skip Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("skip")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("jumpRate", "Jump Rate", juce::NormalisableRange<float>(0.2f, 18.0f, 0.001f, 0.35f), initValue("jumpRate")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("segMs", "Segment Length", juce::NormalisableRange<float>(60.0f, 2500.0f, 0.1f, 0.4f), initValue("segMs")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("melody", "Melody", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("melody")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("spread", "Pitch Spread", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("spread")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("reverse", "Reverse Chance", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("reverse")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("flutter", "Flutter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("flutter")));
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("blur", "Blur", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("blur")));
+        params.push_back(std::make_unique<juce::AudioParameterBool>("stereoLink", "Stereo Link", initValue("stereoLink") >= 0.5f));
+    }
+    else
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>("digital", "Digital", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("digital")));
+    }
+}
+
 juce::AudioProcessorValueTreeState::ParameterLayout DigitalisAudioProcessor::createParameterLayout()
 {
     std::vector<std::unique_ptr<juce::RangedAudioParameter>> params;
 
-    if (kPluginIndex == 1)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("collapse", "Collapse", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 55.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("mantissaBits", "Mantissa Bits", juce::NormalisableRange<float>(3.0f, 23.0f, 1.0f), 11.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("exponentStep", "Exponent Step", juce::NormalisableRange<float>(1.0f, 16.0f, 1.0f), 3.0f));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("temporalHold", "Temporal Hold", juce::StringArray { "1", "2", "4", "8", "16", "32", "64", "128" }, 3));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("blockSize", "Block Size", juce::StringArray { "8", "16", "32", "64", "128", "256", "512", "1024" }, 4));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("quantCurve", "Quant Curve", juce::StringArray { "Uniform", "Log", "MuLaw", "Chaotic" }, 2));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("rounding", "Rounding Chaos", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 18.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("denormal", "Denormal Burst", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 8.0f));
-    }
-    else if (kPluginIndex == 2)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("destroy", "Destroy", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 58.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("minSR", "Min SR", juce::NormalisableRange<float>(1000.0f, 48000.0f, 1.0f), 6000.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("maxSR", "Max SR", juce::NormalisableRange<float>(4000.0f, 96000.0f, 1.0f), 44100.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("modRate", "SR Mod Rate", juce::NormalisableRange<float>(0.05f, 20.0f, 0.001f, 0.33f), 2.4f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("modDepth", "SR Mod Depth", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 72.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("interpErr", "Interp Error", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 48.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("transient", "Transient SR Drop", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 60.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("feedback", "Alias Feedback", juce::NormalisableRange<float>(0.0f, 95.0f, 0.01f), 24.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("fbTone", "Feedback Tone", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 50.0f));
-    }
-    else if (kPluginIndex == 3)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("stress", "Engine Stress", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 52.0f));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("baseBlock", "Base Block", juce::StringArray { "16", "32", "64", "128", "256", "512" }, 2));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("blockJitter", "Block Jitter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 62.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("seam", "Seam Error", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 42.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("tailDrop", "Tail Drop", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 28.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("reorder", "Reorder", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 46.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("lookFail", "Lookahead Failure", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 38.0f));
-    }
-    else if (kPluginIndex == 4)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("brutal", "Brutalism", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 58.0f));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("gridMode", "Grid Mode", juce::StringArray { "Block", "Samples", "Beat" }, 1));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("stepDiv", "Step Division", juce::StringArray { "1", "2", "4", "8", "16", "32", "64", "128" }, 4));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("zipper", "Zipper Tone", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 40.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("levels", "Envelope Levels", juce::NormalisableRange<float>(2.0f, 64.0f, 1.0f), 10.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("phaseLock", "Phase Lock", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 62.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("jitter", "Human Error", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 8.0f));
-    }
-    else if (kPluginIndex == 5)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("artifact", "Artifact", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 56.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("bitrate", "Target Bitrate", juce::NormalisableRange<float>(8.0f, 320.0f, 1.0f), 96.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("masking", "Masking Aggression", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 64.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("smear", "Smear Time", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 42.0f));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("codecMode", "Codec Mode", juce::StringArray { "Fixed MP3", "Cycle", "Random" }, 1));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("switchMs", "Switch Rate", juce::NormalisableRange<float>(40.0f, 1200.0f, 1.0f), 220.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("packetLoss", "Packet Loss", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 18.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("burst", "Burstiness", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 38.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("preecho", "Pre Echo", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 26.0f));
-    }
-    else if (kPluginIndex == 6)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("brutalism", "Brutalism", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 60.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("binDensity", "Bin Density", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 52.0f));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("cluster", "Cluster Size", juce::StringArray { "1", "2", "4", "8", "16", "32" }, 2));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("freezeRate", "Freeze Rate", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 25.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("freezeLen", "Freeze Length", juce::NormalisableRange<float>(10.0f, 1200.0f, 1.0f), 150.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("phaseScramble", "Phase Scramble", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 32.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("phaseSteps", "Phase Steps", juce::NormalisableRange<float>(2.0f, 64.0f, 1.0f), 16.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("sortAmount", "Sort Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 35.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("jitter", "Spectral Jitter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 18.0f));
-    }
-    else if (kPluginIndex == 7)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("overclock", "Overclock", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 55.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("sensitivity", "Stress Sensitivity", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 60.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("failureRate", "Failure Rate", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 34.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("latencySpike", "Latency Spike", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 28.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("desync", "L R Desync", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 32.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("thermal", "Thermal Drift", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 48.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("recovery", "Recovery", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 42.0f));
-    }
-    else if (kPluginIndex == 8)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("determinism", "Determinism", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 62.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("stateCount", "State Count", juce::NormalisableRange<float>(2.0f, 128.0f, 1.0f), 16.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("stateDwell", "State Dwell", juce::NormalisableRange<float>(5.0f, 1200.0f, 1.0f), 120.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("loopMs", "Micro Loop Length", juce::NormalisableRange<float>(5.0f, 60.0f, 0.1f), 28.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("hashWindow", "Hash Window", juce::NormalisableRange<float>(8.0f, 1024.0f, 1.0f), 96.0f));
-        params.push_back(std::make_unique<juce::AudioParameterChoice>("jumpRule", "State Jump Rule", juce::StringArray { "Sequential", "Hash", "Threshold" }, 1));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("memory", "Memory", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 40.0f));
-    }
-    else if (kPluginIndex == 9)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("amount", "Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 54.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("rateHz", "Stutter Rate", juce::NormalisableRange<float>(0.25f, 24.0f, 0.001f, 0.35f), 6.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("sliceMs", "Slice Length", juce::NormalisableRange<float>(10.0f, 250.0f, 0.1f, 0.4f), 52.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("repeats", "Repeats", juce::NormalisableRange<float>(1.0f, 16.0f, 1.0f), 4.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("reverse", "Reverse Chance", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 18.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("timingJitter", "Timing Jitter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 12.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("duck", "Dry Duck", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 34.0f));
-    }
-    else if (kPluginIndex == 10)
-    {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("skip", "Skip Amount", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 58.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("jumpRate", "Jump Rate", juce::NormalisableRange<float>(0.2f, 18.0f, 0.001f, 0.35f), 5.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("segMs", "Segment Length", juce::NormalisableRange<float>(60.0f, 2500.0f, 0.1f, 0.4f), 280.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("melody", "Melody", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 56.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("spread", "Pitch Spread", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 48.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("reverse", "Reverse Chance", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 22.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("flutter", "Flutter", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 16.0f));
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("blur", "Blur", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 24.0f));
+    if (kPluginIndex == kChainPluginIndex)
+    {
+        for (const auto& slot : kChainSlots)
+        {
+            addEngineParameters(params, slot.engine);
+            params.push_back(std::make_unique<juce::AudioParameterBool>(slot.bypassId, slot.bypassName, false));
+        }
     }
     else
     {
-        params.push_back(std::make_unique<juce::AudioParameterFloat>("digital", "Digital", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 45.0f));
+        addEngineParameters(params, kPluginIndex);
     }
 
-    params.push_back(std::make_unique<juce::AudioParameterFloat>("autolevel", "Auto Level", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), defaultAutoLevelPercent()));
-    params.push_back(std::make_unique<juce::AudioParameterFloat>("safety", "Safety", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), defaultSafetyPercent()));
-    params.push_back(std::make_unique<juce::AudioParameterFloat>("output", "Output", juce::NormalisableRange<float>(-24.0f, 24.0f, 0.01f), defaultOutputTrimDb()));
-    params.push_back(std::make_unique<juce::AudioParameterFloat>("mix", "Mix", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), 100.0f));
+    params.push_back(std::make_unique<juce::AudioParameterFloat>("autolevel", "Auto Level", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("autolevel")));
+    params.push_back(std::make_unique<juce::AudioParameterFloat>("safety", "Safety", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("safety")));
+    params.push_back(std::make_unique<juce::AudioParameterFloat>("output", "Output", juce::NormalisableRange<float>(-24.0f, 24.0f, 0.01f), initValue("output")));
+    params.push_back(std::make_unique<juce::AudioParameterFloat>("mix", "Mix", juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f), initValue("mix")));
+    params.push_back(std::make_unique<juce::AudioParameterBool>("limiter", "Limiter", initValue("limiter") >= 0.5f));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>("quality", "Quality", juce::StringArray { "Auto", "Draft", "High" }, initIndex("quality"),
+                                                                  juce::AudioParameterChoiceAttributes().withAutomatable(false)));
+    params.push_back(std::make_unique<juce::AudioParameterBool>("offlineThreads", "Offline Threads", initValue("offlineThreads") >= 0.5f,
+                                                                juce::AudioParameterBoolAttributes().withAutomatable(false)));
     return { params.begin(), params.end() };
 }
 
-std::vector<DigitalisAudioProcessor::FactoryPreset> DigitalisAudioProcessor::createFactoryPresets()
+void DigitalisAudioProcessor::applyFactoryPreset(size_t index)
 {
-    const auto make = [](const char* name, std::initializer_list<PresetParam> values) -> FactoryPreset
+    const auto clamped = juce::jmin(index, kFactoryPresets.size() - 1);
+    const auto& preset = kFactoryPresets[clamped];
+
+    for (int i = 0; i < preset.numValues; ++i)
     {
-        return { name, std::vector<PresetParam>(values.begin(), values.end()) };
-    };
+        const auto& pv = preset.values[(size_t) i];
+        queueParameterValue(*layoutParameters[(size_t) pv.parameter], pv.value);
+    }
 
-    if (kPluginIndex == 1)
-    {
-        return {
-            make("Init", {{ "collapse", 5.0f }, { "mantissaBits", 23.0f }, { "exponentStep", 1.0f }, { "temporalHold", 0.0f }, { "blockSize", 0.0f }, { "quantCurve", 0.0f }, { "rounding", 0.0f }, { "denormal", 0.0f }, { "mix", 100.0f }, { "autolevel", 58.0f }, { "safety", 66.0f }, { "output", -10.1f } }),
-            make("Safe Mix", {{ "collapse", 22.0f }, { "mantissaBits", 16.0f }, { "exponentStep", 2.0f }, { "temporalHold", 2.0f }, { "blockSize", 2.0f }, { "quantCurve", 2.0f }, { "rounding", 8.0f }, { "denormal", 2.0f }, { "mix", 32.0f }, { "autolevel", 62.0f }, { "safety", 70.0f }, { "output", -1.6f } }),
-            make("Subtle Dust", {{ "collapse", 30.0f }, { "mantissaBits", 14.0f }, { "exponentStep", 2.0f }, { "temporalHold", 2.0f }, { "blockSize", 2.0f }, { "quantCurve", 1.0f }, { "rounding", 12.0f }, { "denormal", 2.0f }, { "mix", 45.0f }, { "autolevel", 60.0f }, { "safety", 69.0f }, { "output", -1.4f } }),
-            make("Subtle Glass", {{ "collapse", 35.0f }, { "mantissaBits", 12.0f }, { "exponentStep", 3.0f }, { "temporalHold", 3.0f }, { "blockSize", 3.0f }, { "quantCurve", 2.0f }, { "rounding", 15.0f }, { "denormal", 4.0f }, { "mix", 50.0f }, { "autolevel", 59.0f }, { "safety", 69.0f }, { "output", -1.3f } }),
-            make("Medium Crunch", {{ "collapse", 55.0f }, { "mantissaBits", 10.0f }, { "exponentStep", 4.0f }, { "temporalHold", 3.0f }, { "blockSize", 4.0f }, { "quantCurve", 2.0f }, { "rounding", 24.0f }, { "denormal", 8.0f }, { "mix", 68.0f }, { "autolevel", 58.0f }, { "safety", 70.0f }, { "output", -1.1f } }),
-            make("Medium Pump", {{ "collapse", 60.0f }, { "mantissaBits", 9.0f }, { "exponentStep", 5.0f }, { "temporalHold", 4.0f }, { "blockSize", 4.0f }, { "quantCurve", 3.0f }, { "rounding", 30.0f }, { "denormal", 10.0f }, { "mix", 72.0f }, { "autolevel", 57.0f }, { "safety", 72.0f }, { "output", -1.0f } }),
-            make("Extreme Ruin", {{ "collapse", 85.0f }, { "mantissaBits", 6.0f }, { "exponentStep", 9.0f }, { "temporalHold", 6.0f }, { "blockSize", 6.0f }, { "quantCurve", 3.0f }, { "rounding", 60.0f }, { "denormal", 25.0f }, { "mix", 100.0f }, { "autolevel", 55.0f }, { "safety", 78.0f }, { "output", -2.0f } }),
-            make("Extreme Floatfire", {{ "collapse", 95.0f }, { "mantissaBits", 4.0f }, { "exponentStep", 12.0f }, { "temporalHold", 7.0f }, { "blockSize", 7.0f }, { "quantCurve", 3.0f }, { "rounding", 80.0f }, { "denormal", 40.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 82.0f }, { "output", -3.0f } }),
-            make("Rhythmic Steps", {{ "collapse", 70.0f }, { "mantissaBits", 8.0f }, { "exponentStep", 6.0f }, { "temporalHold", 5.0f }, { "blockSize", 4.0f }, { "quantCurve", 0.0f }, { "rounding", 35.0f }, { "denormal", 8.0f }, { "mix", 78.0f }, { "autolevel", 56.0f }, { "safety", 74.0f }, { "output", -1.6f } }),
-            make("Rhythmic Pulsar", {{ "collapse", 75.0f }, { "mantissaBits", 7.0f }, { "exponentStep", 7.0f }, { "temporalHold", 6.0f }, { "blockSize", 5.0f }, { "quantCurve", 1.0f }, { "rounding", 45.0f }, { "denormal", 12.0f }, { "mix", 80.0f }, { "autolevel", 56.0f }, { "safety", 75.0f }, { "output", -1.8f } })
-        };
+    flushParameterValues();
+    currentProgramIndex = static_cast<int>(clamped);
+    updateHostDisplay(ChangeDetails().withProgramChanged(true));
+}
+
+void DigitalisAudioProcessor::processEngine(int engine, juce::AudioBuffer<float>& buffer)
+{
+    switch (engine)
+    {
+        case 1: processFloatingPointCollapse(buffer); break;
+        case 2: processNyquistDestroyer(buffer); break;
+        case 3: processBufferGlitchEngine(buffer); break;
+        case 4: processAutomationQuantiser(buffer); break;
+        case 5: processStreamingArtifactGenerator(buffer); break;
+        case 6: processFFTBrutalist(buffer); break;
+        case 7: processOverclockFailure(buffer); break;
+        case 8: processDeterministicMachine(buffer); break;
+        case 9: processClassicBufferStutter(buffer); break;
+        case 10: processMelodicSkippingEngine(buffer); break;
+        default: break;
     }
+}
 
-    if (kPluginIndex == 2)
+void DigitalisAudioProcessor::applyPostSafety(juce::AudioBuffer<float>& buffer)
+{
+    const auto autoLevel = parameters.getRawParameterValue("autolevel")->load() * 0.01f;
+    const auto safety = parameters.getRawParameterValue("safety")->load() * 0.01f;
+    const auto outputTrimDb = parameters.getRawParameterValue("output")->load();
+    const auto outputGain = juce::Decibels::decibelsToGain(outputTrimDb);
+
+    const auto channels = getTotalNumInputChannels();
+    const auto numSamples = buffer.getNumSamples();
+    const auto targetRms = targetRmsForPlugin();
+
+    // Per-tick equivalents of a ~referenceBlockSize level window and the original 0.02-per-block glide.
+    const auto tickRatio = static_cast<float>(controlBlockSize) / static_cast<float>(referenceBlockSize);
+    const auto levelCoeff = 1.0f - std::exp(-tickRatio);
+    const auto glideCoeff = 1.0f - std::pow(0.98f, tickRatio);
+
+    // An engine that has blown up is silenced here, and the state below is put back to rest, so
+    // the finishing stage can't latch on its output.
+    for (int ch = 0; ch < channels; ++ch)
+        digitalis::flushNonFinite(buffer.getWritePointer(ch), numSamples);
+
+    if (! std::isfinite(postLevelMeanSquare) || ! std::isfinite(postAutoLevelGain) || ! std::isfinite(postControlSumSq))
     {
-        return {
-            make("Init", {{ "destroy", 4.0f }, { "minSR", 22050.0f }, { "maxSR", 48000.0f }, { "modRate", 0.2f }, { "modDepth", 0.0f }, { "interpErr", 0.0f }, { "transient", 0.0f }, { "feedback", 0.0f }, { "fbTone", 50.0f }, { "mix", 100.0f }, { "autolevel", 46.0f }, { "safety", 61.0f }, { "output", -9.6f } }),
-            make("Safe Mix", {{ "destroy", 28.0f }, { "minSR", 12000.0f }, { "maxSR", 48000.0f }, { "modRate", 0.7f }, { "modDepth", 35.0f }, { "interpErr", 20.0f }, { "transient", 26.0f }, { "feedback", 8.0f }, { "fbTone", 46.0f }, { "mix", 35.0f }, { "autolevel", 52.0f }, { "safety", 66.0f }, { "output", -1.2f } }),
-            make("Subtle Fold", {{ "destroy", 35.0f }, { "minSR", 9000.0f }, { "maxSR", 44100.0f }, { "modRate", 0.9f }, { "modDepth", 42.0f }, { "interpErr", 28.0f }, { "transient", 30.0f }, { "feedback", 12.0f }, { "fbTone", 42.0f }, { "mix", 52.0f }, { "autolevel", 50.0f }, { "safety", 67.0f }, { "output", -1.0f } }),
-            make("Subtle Mirror", {{ "destroy", 40.0f }, { "minSR", 7600.0f }, { "maxSR", 48000.0f }, { "modRate", 1.3f }, { "modDepth", 46.0f }, { "interpErr", 30.0f }, { "transient", 35.0f }, { "feedback", 14.0f }, { "fbTone", 55.0f }, { "mix", 56.0f }, { "autolevel", 49.0f }, { "safety", 68.0f }, { "output", -1.1f } }),
-            make("Medium Shred", {{ "destroy", 58.0f }, { "minSR", 5500.0f }, { "maxSR", 44100.0f }, { "modRate", 2.1f }, { "modDepth", 62.0f }, { "interpErr", 48.0f }, { "transient", 56.0f }, { "feedback", 22.0f }, { "fbTone", 50.0f }, { "mix", 74.0f }, { "autolevel", 47.0f }, { "safety", 70.0f }, { "output", -1.4f } }),
-            make("Medium Motion", {{ "destroy", 64.0f }, { "minSR", 4200.0f }, { "maxSR", 52000.0f }, { "modRate", 3.4f }, { "modDepth", 70.0f }, { "interpErr", 56.0f }, { "transient", 62.0f }, { "feedback", 28.0f }, { "fbTone", 36.0f }, { "mix", 78.0f }, { "autolevel", 46.0f }, { "safety", 72.0f }, { "output", -1.6f } }),
-            make("Extreme Shatter", {{ "destroy", 90.0f }, { "minSR", 1800.0f }, { "maxSR", 96000.0f }, { "modRate", 8.0f }, { "modDepth", 92.0f }, { "interpErr", 88.0f }, { "transient", 90.0f }, { "feedback", 55.0f }, { "fbTone", 30.0f }, { "mix", 100.0f }, { "autolevel", 43.0f }, { "safety", 79.0f }, { "output", -2.8f } }),
-            make("Extreme Spiral", {{ "destroy", 96.0f }, { "minSR", 1000.0f }, { "maxSR", 96000.0f }, { "modRate", 15.0f }, { "modDepth", 98.0f }, { "interpErr", 95.0f }, { "transient", 95.0f }, { "feedback", 72.0f }, { "fbTone", 22.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 84.0f }, { "output", -3.4f } }),
-            make("Rhythmic Fold", {{ "destroy", 72.0f }, { "minSR", 3200.0f }, { "maxSR", 42000.0f }, { "modRate", 4.0f }, { "modDepth", 76.0f }, { "interpErr", 64.0f }, { "transient", 70.0f }, { "feedback", 30.0f }, { "fbTone", 44.0f }, { "mix", 82.0f }, { "autolevel", 45.0f }, { "safety", 74.0f }, { "output", -1.9f } }),
-            make("Rhythmic Alias Kick", {{ "destroy", 78.0f }, { "minSR", 2600.0f }, { "maxSR", 36000.0f }, { "modRate", 6.2f }, { "modDepth", 84.0f }, { "interpErr", 72.0f }, { "transient", 82.0f }, { "feedback", 42.0f }, { "fbTone", 40.0f }, { "mix", 86.0f }, { "autolevel", 44.0f }, { "safety", 76.0f }, { "output", -2.2f } })
-        };
+        postLevelMeanSquare = targetRms * targetRms;
+        postAutoLevelGain = 1.0f;
+        postControlSumSq = 0.0f;
     }
 
-    if (kPluginIndex == 3)
+    for (size_t c = 0; c < 2; ++c)
     {
-        return {
-            make("Init", {{ "stress", 4.0f }, { "baseBlock", 2.0f }, { "blockJitter", 0.0f }, { "seam", 0.0f }, { "tailDrop", 0.0f }, { "reorder", 0.0f }, { "lookFail", 0.0f }, { "mix", 100.0f }, { "autolevel", 52.0f }, { "safety", 70.0f }, { "output", -9.7f } }),
-            make("Safe Mix", {{ "stress", 25.0f }, { "baseBlock", 2.0f }, { "blockJitter", 25.0f }, { "seam", 15.0f }, { "tailDrop", 8.0f }, { "reorder", 12.0f }, { "lookFail", 10.0f }, { "mix", 30.0f }, { "autolevel", 58.0f }, { "safety", 74.0f }, { "output", -2.2f } }),
-            make("Subtle Drift", {{ "stress", 34.0f }, { "baseBlock", 2.0f }, { "blockJitter", 36.0f }, { "seam", 24.0f }, { "tailDrop", 10.0f }, { "reorder", 18.0f }, { "lookFail", 14.0f }, { "mix", 50.0f }, { "autolevel", 56.0f }, { "safety", 73.0f }, { "output", -2.0f } }),
-            make("Subtle Slips", {{ "stress", 38.0f }, { "baseBlock", 3.0f }, { "blockJitter", 32.0f }, { "seam", 30.0f }, { "tailDrop", 14.0f }, { "reorder", 24.0f }, { "lookFail", 18.0f }, { "mix", 54.0f }, { "autolevel", 55.0f }, { "safety", 74.0f }, { "output", -2.1f } }),
-            make("Medium Stutter", {{ "stress", 56.0f }, { "baseBlock", 1.0f }, { "blockJitter", 58.0f }, { "seam", 44.0f }, { "tailDrop", 28.0f }, { "reorder", 42.0f }, { "lookFail", 36.0f }, { "mix", 76.0f }, { "autolevel", 52.0f }, { "safety", 76.0f }, { "output", -2.4f } }),
-            make("Medium Seams", {{ "stress", 62.0f }, { "baseBlock", 0.0f }, { "blockJitter", 64.0f }, { "seam", 56.0f }, { "tailDrop", 30.0f }, { "reorder", 48.0f }, { "lookFail", 40.0f }, { "mix", 80.0f }, { "autolevel", 51.0f }, { "safety", 77.0f }, { "output", -2.6f } }),
-            make("Extreme Engine Fail", {{ "stress", 90.0f }, { "baseBlock", 0.0f }, { "blockJitter", 95.0f }, { "seam", 88.0f }, { "tailDrop", 72.0f }, { "reorder", 86.0f }, { "lookFail", 78.0f }, { "mix", 100.0f }, { "autolevel", 45.0f }, { "safety", 84.0f }, { "output", -4.0f } }),
-            make("Extreme Buffer Crash", {{ "stress", 96.0f }, { "baseBlock", 0.0f }, { "blockJitter", 100.0f }, { "seam", 94.0f }, { "tailDrop", 84.0f }, { "reorder", 94.0f }, { "lookFail", 92.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 87.0f }, { "output", -5.0f } }),
-            make("Rhythmic Chunks", {{ "stress", 70.0f }, { "baseBlock", 1.0f }, { "blockJitter", 72.0f }, { "seam", 50.0f }, { "tailDrop", 40.0f }, { "reorder", 62.0f }, { "lookFail", 50.0f }, { "mix", 84.0f }, { "autolevel", 49.0f }, { "safety", 79.0f }, { "output", -3.0f } }),
-            make("Rhythmic Shard Gate", {{ "stress", 78.0f }, { "baseBlock", 0.0f }, { "blockJitter", 82.0f }, { "seam", 62.0f }, { "tailDrop", 52.0f }, { "reorder", 72.0f }, { "lookFail", 64.0f }, { "mix", 88.0f }, { "autolevel", 48.0f }, { "safety", 80.0f }, { "output", -3.4f } })
-        };
+        if (! std::isfinite(postDcPrevInput[c]) || ! std::isfinite(postDcPrevOutput[c]))
+        {
+            postDcPrevInput[c] = 0.0f;
+            postDcPrevOutput[c] = 0.0f;
+        }
     }
 
-    if (kPluginIndex == 4)
+    const auto dcR = 0.995f;
+    const auto drive = juce::jmap(safety, 1.0f, 4.2f);
+    const auto softNorm = 1.0f / std::tanh(drive);
+    const auto hardLimit = juce::jmap(safety, 0.995f, 0.8f);
+
+    const auto shaper = [&](float y) { return juce::jlimit(-hardLimit, hardLimit, saturate(y * drive) * softNorm); };
+
+    // softNorm * tanh(drive) is 1, above hardLimit, so the soft clip is flat beyond +-1 and the
+    // whole stage bakes into one table. A bake is 2049 shaper calls, more than a short block costs
+    // run directly, so while Safety is moving the shaper runs per sample and the table is only
+    // rebaked once the key has held still for 50 ms.
+    auto useCurve = false;
+    if (! limiterActive)
     {
-        return {
-            make("Init", {{ "brutal", 42.0f }, { "gridMode", 1.0f }, { "stepDiv", 4.0f }, { "zipper", 42.0f }, { "levels", 12.0f }, { "phaseLock", 72.0f }, { "jitter", 6.0f }, { "mix", 100.0f }, { "autolevel", 54.0f }, { "safety", 58.0f }, { "output", 1.5f } }),
-            make("Safe Mix", {{ "brutal", 24.0f }, { "gridMode", 1.0f }, { "stepDiv", 3.0f }, { "zipper", 14.0f }, { "levels", 24.0f }, { "phaseLock", 25.0f }, { "jitter", 4.0f }, { "mix", 34.0f }, { "autolevel", 58.0f }, { "safety", 64.0f }, { "output", -1.0f } }),
-            make("Subtle Stepped", {{ "brutal", 32.0f }, { "gridMode", 1.0f }, { "stepDiv", 4.0f }, { "zipper", 20.0f }, { "levels", 20.0f }, { "phaseLock", 35.0f }, { "jitter", 8.0f }, { "mix", 52.0f }, { "autolevel", 56.0f }, { "safety", 63.0f }, { "output", -0.8f } }),
-            make("Subtle Quant Grid", {{ "brutal", 38.0f }, { "gridMode", 0.0f }, { "stepDiv", 4.0f }, { "zipper", 28.0f }, { "levels", 16.0f }, { "phaseLock", 46.0f }, { "jitter", 7.0f }, { "mix", 56.0f }, { "autolevel", 55.0f }, { "safety", 64.0f }, { "output", -0.9f } }),
-            make("Medium Brutal Seq", {{ "brutal", 58.0f }, { "gridMode", 2.0f }, { "stepDiv", 5.0f }, { "zipper", 48.0f }, { "levels", 10.0f }, { "phaseLock", 62.0f }, { "jitter", 10.0f }, { "mix", 74.0f }, { "autolevel", 53.0f }, { "safety", 66.0f }, { "output", -1.2f } }),
-            make("Medium Stair Drive", {{ "brutal", 64.0f }, { "gridMode", 0.0f }, { "stepDiv", 6.0f }, { "zipper", 56.0f }, { "levels", 8.0f }, { "phaseLock", 70.0f }, { "jitter", 12.0f }, { "mix", 78.0f }, { "autolevel", 52.0f }, { "safety", 67.0f }, { "output", -1.3f } }),
-            make("Extreme Zipper", {{ "brutal", 92.0f }, { "gridMode", 0.0f }, { "stepDiv", 7.0f }, { "zipper", 95.0f }, { "levels", 4.0f }, { "phaseLock", 90.0f }, { "jitter", 18.0f }, { "mix", 100.0f }, { "autolevel", 48.0f }, { "safety", 73.0f }, { "output", -2.0f } }),
-            make("Extreme Clocked Bits", {{ "brutal", 96.0f }, { "gridMode", 2.0f }, { "stepDiv", 7.0f }, { "zipper", 88.0f }, { "levels", 3.0f }, { "phaseLock", 100.0f }, { "jitter", 24.0f }, { "mix", 100.0f }, { "autolevel", 47.0f }, { "safety", 74.0f }, { "output", -2.4f } }),
-            make("Rhythmic Grid Chop", {{ "brutal", 72.0f }, { "gridMode", 2.0f }, { "stepDiv", 6.0f }, { "zipper", 60.0f }, { "levels", 6.0f }, { "phaseLock", 84.0f }, { "jitter", 14.0f }, { "mix", 84.0f }, { "autolevel", 50.0f }, { "safety", 69.0f }, { "output", -1.6f } }),
-            make("Rhythmic Phase Snap", {{ "brutal", 78.0f }, { "gridMode", 2.0f }, { "stepDiv", 5.0f }, { "zipper", 68.0f }, { "levels", 5.0f }, { "phaseLock", 96.0f }, { "jitter", 10.0f }, { "mix", 86.0f }, { "autolevel", 49.0f }, { "safety", 70.0f }, { "output", -1.8f } })
-        };
+        const std::array<float, 4> curveKey { drive, hardLimit, static_cast<float>(qualityTier), 0.0f };
+        useCurve = postSafetyCurve.isBakedFor(curveKey, 1.0f);
+
+        if (! useCurve)
+        {
+            if (! TransferCurve::sameKey(curveKey, postCurvePendingKey))
+            {
+                postCurvePendingKey = curveKey;
+                postCurveSettledSamples = 0;
+            }
+            else if ((postCurveSettledSamples += numSamples) >= static_cast<int>(0.05 * currentSampleRate))
+            {
+                postSafetyCurve.bake(curveKey, 1.0f, shaper);
+                useCurve = true;
+            }
+        }
     }
 
-    if (kPluginIndex == 5)
+    for (int start = 0; start < numSamples;)
     {
-        return {
-            make("Init", {{ "artifact", 4.0f }, { "bitrate", 320.0f }, { "masking", 0.0f }, { "smear", 0.0f }, { "codecMode", 0.0f }, { "switchMs", 400.0f }, { "packetLoss", 0.0f }, { "burst", 0.0f }, { "preecho", 0.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 72.0f }, { "output", -8.4f } }),
-            make("Safe Mix", {{ "artifact", 24.0f }, { "bitrate", 160.0f }, { "masking", 24.0f }, { "smear", 18.0f }, { "codecMode", 1.0f }, { "switchMs", 360.0f }, { "packetLoss", 8.0f }, { "burst", 16.0f }, { "preecho", 10.0f }, { "mix", 30.0f }, { "autolevel", 50.0f }, { "safety", 76.0f }, { "output", -3.0f } }),
-            make("Subtle Stream Wear", {{ "artifact", 34.0f }, { "bitrate", 128.0f }, { "masking", 34.0f }, { "smear", 28.0f }, { "codecMode", 1.0f }, { "switchMs", 300.0f }, { "packetLoss", 12.0f }, { "burst", 24.0f }, { "preecho", 14.0f }, { "mix", 48.0f }, { "autolevel", 47.0f }, { "safety", 76.0f }, { "output", -2.8f } }),
-            make("Subtle Codec Drift", {{ "artifact", 40.0f }, { "bitrate", 112.0f }, { "masking", 42.0f }, { "smear", 36.0f }, { "codecMode", 2.0f }, { "switchMs", 240.0f }, { "packetLoss", 14.0f }, { "burst", 28.0f }, { "preecho", 18.0f }, { "mix", 54.0f }, { "autolevel", 46.0f }, { "safety", 77.0f }, { "output", -3.0f } }),
-            make("Medium Artifact Bed", {{ "artifact", 58.0f }, { "bitrate", 84.0f }, { "masking", 62.0f }, { "smear", 50.0f }, { "codecMode", 1.0f }, { "switchMs", 200.0f }, { "packetLoss", 22.0f }, { "burst", 40.0f }, { "preecho", 28.0f }, { "mix", 74.0f }, { "autolevel", 44.0f }, { "safety", 80.0f }, { "output", -3.4f } }),
-            make("Medium GSM Dust", {{ "artifact", 64.0f }, { "bitrate", 64.0f }, { "masking", 70.0f }, { "smear", 58.0f }, { "codecMode", 0.0f }, { "switchMs", 180.0f }, { "packetLoss", 28.0f }, { "burst", 52.0f }, { "preecho", 34.0f }, { "mix", 78.0f }, { "autolevel", 43.0f }, { "safety", 81.0f }, { "output", -3.8f } }),
-            make("Extreme Packet Storm", {{ "artifact", 92.0f }, { "bitrate", 20.0f }, { "masking", 95.0f }, { "smear", 84.0f }, { "codecMode", 2.0f }, { "switchMs", 90.0f }, { "packetLoss", 72.0f }, { "burst", 90.0f }, { "preecho", 68.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 88.0f }, { "output", -5.2f } }),
-            make("Extreme Modem Hell", {{ "artifact", 98.0f }, { "bitrate", 8.0f }, { "masking", 100.0f }, { "smear", 96.0f }, { "codecMode", 2.0f }, { "switchMs", 60.0f }, { "packetLoss", 86.0f }, { "burst", 100.0f }, { "preecho", 84.0f }, { "mix", 100.0f }, { "autolevel", 34.0f }, { "safety", 90.0f }, { "output", -6.5f } }),
-            make("Rhythmic Drop Frames", {{ "artifact", 74.0f }, { "bitrate", 42.0f }, { "masking", 78.0f }, { "smear", 62.0f }, { "codecMode", 1.0f }, { "switchMs", 180.0f }, { "packetLoss", 44.0f }, { "burst", 70.0f }, { "preecho", 36.0f }, { "mix", 84.0f }, { "autolevel", 41.0f }, { "safety", 84.0f }, { "output", -4.4f } }),
-            make("Rhythmic Switch Jam", {{ "artifact", 80.0f }, { "bitrate", 36.0f }, { "masking", 84.0f }, { "smear", 70.0f }, { "codecMode", 2.0f }, { "switchMs", 120.0f }, { "packetLoss", 50.0f }, { "burst", 76.0f }, { "preecho", 44.0f }, { "mix", 88.0f }, { "autolevel", 40.0f }, { "safety", 85.0f }, { "output", -4.9f } })
-        };
+        const auto segment = juce::jmin(postControlCountdown, numSamples - start);
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            postControlSumSq += digitalis::kernels().sumOfSquares(buffer.getReadPointer(ch, start), segment);
+        }
+
+        postControlCountdown -= segment;
+        if (postControlCountdown <= 0)
+        {
+            const auto meanSquare = postControlSumSq / static_cast<float>(juce::jmax(1, channels * controlBlockSize));
+            postLevelMeanSquare += (meanSquare - postLevelMeanSquare) * levelCoeff;
+            const auto rms = std::sqrt(postLevelMeanSquare);
+            const auto compensation = juce::jlimit(0.25f, 4.0f, targetRms / (rms + 1.0e-6f));
+            postAutoLevelGain += (compensation - postAutoLevelGain) * glideCoeff;
+            postControlSumSq = 0.0f;
+            postControlCountdown = controlBlockSize;
+        }
+
+        const auto gain = outputGain * juce::jmap(autoLevel, 1.0f, postAutoLevelGain);
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const auto c = static_cast<size_t>(ch);
+            auto* write = buffer.getWritePointer(ch, start);
+
+            for (int i = 0; i < segment; ++i)
+            {
+                auto x = write[i];
+                const auto dc = x - postDcPrevInput[c] + dcR * postDcPrevOutput[c];
+                postDcPrevInput[c] = x;
+                postDcPrevOutput[c] = dc;
+
+                write[i] = dc * gain;
+            }
+
+            if (useCurve)
+            {
+                postSafetyCurve.process(write, segment);
+            }
+            else if (! limiterActive)
+            {
+                for (int i = 0; i < segment; ++i)
+                    write[i] = shaper(write[i]);
+            }
+        }
+
+        start += segment;
     }
 
-    if (kPluginIndex == 6)
+    // The limiter replaces the tanh stage rather than following it, so the safety ceiling is
+    // reached without the soft-clip colour. Bypassed, the signal still goes through its delay.
+    if (limiterActive)
+        applyLookaheadLimiter(buffer, hardLimit);
+    else
+        applyLimiterDelay(buffer);
+}
+
+bool DigitalisAudioProcessor::shouldSleep(const juce::AudioBuffer<float>& buffer)
+{
+    const auto numSamples = buffer.getNumSamples();
+
+    if (buffer.getMagnitude(0, numSamples) >= kSilenceThreshold)
     {
-        return {
-            make("Init", {{ "brutalism", 4.0f }, { "binDensity", 0.0f }, { "cluster", 0.0f }, { "freezeRate", 0.0f }, { "freezeLen", 60.0f }, { "phaseScramble", 0.0f }, { "phaseSteps", 64.0f }, { "sortAmount", 0.0f }, { "jitter", 0.0f }, { "mix", 100.0f }, { "autolevel", 36.0f }, { "safety", 76.0f }, { "output", -10.0f } }),
-            make("Safe Mix", {{ "brutalism", 24.0f }, { "binDensity", 24.0f }, { "cluster", 1.0f }, { "freezeRate", 10.0f }, { "freezeLen", 120.0f }, { "phaseScramble", 14.0f }, { "phaseSteps", 24.0f }, { "sortAmount", 16.0f }, { "jitter", 8.0f }, { "mix", 28.0f }, { "autolevel", 43.0f }, { "safety", 80.0f }, { "output", -3.2f } }),
-            make("Subtle Spectral Tilt", {{ "brutalism", 36.0f }, { "binDensity", 32.0f }, { "cluster", 2.0f }, { "freezeRate", 16.0f }, { "freezeLen", 180.0f }, { "phaseScramble", 20.0f }, { "phaseSteps", 20.0f }, { "sortAmount", 24.0f }, { "jitter", 12.0f }, { "mix", 50.0f }, { "autolevel", 41.0f }, { "safety", 80.0f }, { "output", -3.0f } }),
-            make("Subtle Frozen Glass", {{ "brutalism", 42.0f }, { "binDensity", 38.0f }, { "cluster", 2.0f }, { "freezeRate", 28.0f }, { "freezeLen", 260.0f }, { "phaseScramble", 28.0f }, { "phaseSteps", 16.0f }, { "sortAmount", 30.0f }, { "jitter", 16.0f }, { "mix", 56.0f }, { "autolevel", 40.0f }, { "safety", 81.0f }, { "output", -3.2f } }),
-            make("Medium Bin Vandal", {{ "brutalism", 62.0f }, { "binDensity", 58.0f }, { "cluster", 3.0f }, { "freezeRate", 36.0f }, { "freezeLen", 320.0f }, { "phaseScramble", 52.0f }, { "phaseSteps", 12.0f }, { "sortAmount", 48.0f }, { "jitter", 24.0f }, { "mix", 76.0f }, { "autolevel", 38.0f }, { "safety", 83.0f }, { "output", -3.8f } }),
-            make("Medium Phase Teeth", {{ "brutalism", 68.0f }, { "binDensity", 64.0f }, { "cluster", 4.0f }, { "freezeRate", 42.0f }, { "freezeLen", 380.0f }, { "phaseScramble", 66.0f }, { "phaseSteps", 8.0f }, { "sortAmount", 60.0f }, { "jitter", 30.0f }, { "mix", 80.0f }, { "autolevel", 37.0f }, { "safety", 84.0f }, { "output", -4.2f } }),
-            make("Extreme FFT Wreck", {{ "brutalism", 92.0f }, { "binDensity", 92.0f }, { "cluster", 5.0f }, { "freezeRate", 78.0f }, { "freezeLen", 700.0f }, { "phaseScramble", 94.0f }, { "phaseSteps", 4.0f }, { "sortAmount", 92.0f }, { "jitter", 62.0f }, { "mix", 100.0f }, { "autolevel", 32.0f }, { "safety", 90.0f }, { "output", -6.0f } }),
-            make("Extreme Frozen Wall", {{ "brutalism", 98.0f }, { "binDensity", 100.0f }, { "cluster", 5.0f }, { "freezeRate", 96.0f }, { "freezeLen", 1100.0f }, { "phaseScramble", 100.0f }, { "phaseSteps", 2.0f }, { "sortAmount", 100.0f }, { "jitter", 78.0f }, { "mix", 100.0f }, { "autolevel", 30.0f }, { "safety", 92.0f }, { "output", -7.0f } }),
-            make("Rhythmic Spectral Gate", {{ "brutalism", 74.0f }, { "binDensity", 70.0f }, { "cluster", 3.0f }, { "freezeRate", 54.0f }, { "freezeLen", 260.0f }, { "phaseScramble", 72.0f }, { "phaseSteps", 10.0f }, { "sortAmount", 66.0f }, { "jitter", 34.0f }, { "mix", 84.0f }, { "autolevel", 35.0f }, { "safety", 86.0f }, { "output", -4.6f } }),
-            make("Rhythmic Bin Shuffle", {{ "brutalism", 80.0f }, { "binDensity", 78.0f }, { "cluster", 4.0f }, { "freezeRate", 62.0f }, { "freezeLen", 320.0f }, { "phaseScramble", 80.0f }, { "phaseSteps", 6.0f }, { "sortAmount", 74.0f }, { "jitter", 42.0f }, { "mix", 88.0f }, { "autolevel", 34.0f }, { "safety", 87.0f }, { "output", -5.0f } })
-        };
+        silentInputSamples = 0;
+        lastOutputPeak = 1.0f; // unknown until a silent block has been processed
+        return false;
     }
 
-    if (kPluginIndex == 7)
+    silentInputSamples = juce::jmin(silentInputSamples + numSamples, 1 << 30);
+
+    // Everything still in flight: the reported latency (codec, oversampler, limiter delay) plus
+    // whatever the running engines hold in their buffers. A bypassed chain slot holds nothing.
+    auto inFlight = getLatencySamples();
+    auto quiet = lastOutputPeak < kSilenceThreshold && isQuiet(postDcPrevOutput);
+
+    const auto addEngine = [&](int engine)
     {
-        return {
-            make("Init", {{ "overclock", 4.0f }, { "sensitivity", 10.0f }, { "failureRate", 0.0f }, { "latencySpike", 0.0f }, { "desync", 0.0f }, { "thermal", 0.0f }, { "recovery", 80.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 74.0f }, { "output", -10.0f } }),
-            make("Safe Mix", {{ "overclock", 26.0f }, { "sensitivity", 34.0f }, { "failureRate", 14.0f }, { "latencySpike", 12.0f }, { "desync", 10.0f }, { "thermal", 16.0f }, { "recovery", 72.0f }, { "mix", 34.0f }, { "autolevel", 56.0f }, { "safety", 77.0f }, { "output", -2.3f } }),
-            make("Subtle Drift CPU", {{ "overclock", 36.0f }, { "sensitivity", 44.0f }, { "failureRate", 22.0f }, { "latencySpike", 18.0f }, { "desync", 18.0f }, { "thermal", 24.0f }, { "recovery", 62.0f }, { "mix", 50.0f }, { "autolevel", 54.0f }, { "safety", 77.0f }, { "output", -2.1f } }),
-            make("Subtle Thread Pull", {{ "overclock", 42.0f }, { "sensitivity", 50.0f }, { "failureRate", 26.0f }, { "latencySpike", 24.0f }, { "desync", 30.0f }, { "thermal", 30.0f }, { "recovery", 58.0f }, { "mix", 56.0f }, { "autolevel", 53.0f }, { "safety", 78.0f }, { "output", -2.3f } }),
-            make("Medium Unstable Core", {{ "overclock", 60.0f }, { "sensitivity", 66.0f }, { "failureRate", 42.0f }, { "latencySpike", 40.0f }, { "desync", 42.0f }, { "thermal", 46.0f }, { "recovery", 46.0f }, { "mix", 76.0f }, { "autolevel", 50.0f }, { "safety", 80.0f }, { "output", -2.8f } }),
-            make("Medium Heat Bloom", {{ "overclock", 68.0f }, { "sensitivity", 72.0f }, { "failureRate", 48.0f }, { "latencySpike", 54.0f }, { "desync", 52.0f }, { "thermal", 62.0f }, { "recovery", 40.0f }, { "mix", 80.0f }, { "autolevel", 49.0f }, { "safety", 81.0f }, { "output", -3.1f } }),
-            make("Extreme Overheat", {{ "overclock", 94.0f }, { "sensitivity", 92.0f }, { "failureRate", 82.0f }, { "latencySpike", 78.0f }, { "desync", 82.0f }, { "thermal", 90.0f }, { "recovery", 20.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 88.0f }, { "output", -4.8f } }),
-            make("Extreme Clock Loss", {{ "overclock", 100.0f }, { "sensitivity", 100.0f }, { "failureRate", 94.0f }, { "latencySpike", 92.0f }, { "desync", 96.0f }, { "thermal", 100.0f }, { "recovery", 10.0f }, { "mix", 100.0f }, { "autolevel", 38.0f }, { "safety", 90.0f }, { "output", -6.2f } }),
-            make("Rhythmic Stall", {{ "overclock", 74.0f }, { "sensitivity", 78.0f }, { "failureRate", 58.0f }, { "latencySpike", 64.0f }, { "desync", 54.0f }, { "thermal", 56.0f }, { "recovery", 34.0f }, { "mix", 84.0f }, { "autolevel", 47.0f }, { "safety", 83.0f }, { "output", -3.6f } }),
-            make("Rhythmic Desync Pulse", {{ "overclock", 80.0f }, { "sensitivity", 84.0f }, { "failureRate", 64.0f }, { "latencySpike", 70.0f }, { "desync", 70.0f }, { "thermal", 64.0f }, { "recovery", 30.0f }, { "mix", 88.0f }, { "autolevel", 46.0f }, { "safety", 84.0f }, { "output", -3.9f } })
-        };
+        inFlight += engineMemorySamples(engine);
+        quiet = quiet && engineStateIsQuiet(engine) && ! engineGeneratesFromSilence(engine);
+    };
+
+    if (kPluginIndex == kChainPluginIndex)
+    {
+        for (const auto& slot : kChainSlots)
+            if (parameters.getRawParameterValue(slot.bypassId)->load() < 0.5f)
+                addEngine(slot.engine);
+    }
+    else
+    {
+        addEngine(kPluginIndex);
     }
 
-    if (kPluginIndex == 8)
+    return quiet && silentInputSamples > inFlight;
+}
+
+int DigitalisAudioProcessor::engineMemorySamples(int engine) const
+{
+    const auto value = [this](const char* id) { return parameters.getRawParameterValue(id)->load(); };
+
+    switch (engine)
     {
-        return {
-            make("Init", {{ "determinism", 4.0f }, { "stateCount", 2.0f }, { "stateDwell", 1200.0f }, { "loopMs", 5.0f }, { "hashWindow", 1024.0f }, { "jumpRule", 0.0f }, { "memory", 0.0f }, { "mix", 100.0f }, { "autolevel", 48.0f }, { "safety", 63.0f }, { "output", -16.1f } }),
-            make("Safe Mix", {{ "determinism", 24.0f }, { "stateCount", 8.0f }, { "stateDwell", 380.0f }, { "loopMs", 16.0f }, { "hashWindow", 240.0f }, { "jumpRule", 1.0f }, { "memory", 24.0f }, { "mix", 36.0f }, { "autolevel", 54.0f }, { "safety", 68.0f }, { "output", -1.6f } }),
-            make("Subtle Robot Grain", {{ "determinism", 34.0f }, { "stateCount", 14.0f }, { "stateDwell", 300.0f }, { "loopMs", 20.0f }, { "hashWindow", 200.0f }, { "jumpRule", 1.0f }, { "memory", 34.0f }, { "mix", 52.0f }, { "autolevel", 52.0f }, { "safety", 67.0f }, { "output", -1.4f } }),
-            make("Subtle Loop Grid", {{ "determinism", 40.0f }, { "stateCount", 18.0f }, { "stateDwell", 240.0f }, { "loopMs", 24.0f }, { "hashWindow", 160.0f }, { "jumpRule", 0.0f }, { "memory", 44.0f }, { "mix", 58.0f }, { "autolevel", 51.0f }, { "safety", 68.0f }, { "output", -1.5f } }),
-            make("Medium Finite Groove", {{ "determinism", 60.0f }, { "stateCount", 24.0f }, { "stateDwell", 180.0f }, { "loopMs", 30.0f }, { "hashWindow", 120.0f }, { "jumpRule", 1.0f }, { "memory", 48.0f }, { "mix", 76.0f }, { "autolevel", 49.0f }, { "safety", 70.0f }, { "output", -1.9f } }),
-            make("Medium Hash Runner", {{ "determinism", 66.0f }, { "stateCount", 36.0f }, { "stateDwell", 120.0f }, { "loopMs", 34.0f }, { "hashWindow", 96.0f }, { "jumpRule", 1.0f }, { "memory", 54.0f }, { "mix", 80.0f }, { "autolevel", 48.0f }, { "safety", 71.0f }, { "output", -2.1f } }),
-            make("Extreme Determinator", {{ "determinism", 92.0f }, { "stateCount", 96.0f }, { "stateDwell", 50.0f }, { "loopMs", 50.0f }, { "hashWindow", 40.0f }, { "jumpRule", 1.0f }, { "memory", 74.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 77.0f }, { "output", -3.6f } }),
-            make("Extreme State Prison", {{ "determinism", 98.0f }, { "stateCount", 128.0f }, { "stateDwell", 20.0f }, { "loopMs", 60.0f }, { "hashWindow", 8.0f }, { "jumpRule", 2.0f }, { "memory", 88.0f }, { "mix", 100.0f }, { "autolevel", 39.0f }, { "safety", 80.0f }, { "output", -4.8f } }),
-            make("Rhythmic Loop Grid", {{ "determinism", 74.0f }, { "stateCount", 40.0f }, { "stateDwell", 90.0f }, { "loopMs", 36.0f }, { "hashWindow", 72.0f }, { "jumpRule", 0.0f }, { "memory", 58.0f }, { "mix", 84.0f }, { "autolevel", 46.0f }, { "safety", 73.0f }, { "output", -2.5f } }),
-            make("Rhythmic Hash Pulse", {{ "determinism", 80.0f }, { "stateCount", 52.0f }, { "stateDwell", 70.0f }, { "loopMs", 40.0f }, { "hashWindow", 56.0f }, { "jumpRule", 1.0f }, { "memory", 64.0f }, { "mix", 88.0f }, { "autolevel", 45.0f }, { "safety", 74.0f }, { "output", -2.8f } })
-        };
+        case 1:
+        {
+            // The temporal hold repeats one sample for up to 128 samples.
+            constexpr std::array<int, 8> holdSteps { 1, 2, 4, 8, 16, 32, 64, 128 };
+            return holdSteps[(size_t) juce::jlimit(0, 7, static_cast<int>(value("temporalHold")))];
+        }
+        case 2:
+            // One held step at the lowest internal rate and the band-limited step after it; the
+            // feedback loop is checked separately.
+            return juce::jmax(2, static_cast<int>(currentSampleRate / 600.0)) + nyqBlepLength;
+        case 3:
+            // A swapped or duplicated chunk replays the previous one, which is at most 1024 samples.
+            return 1024;
+        case 5:
+        {
+            // Lost frames conceal from the last good spectrum, fading by 0.7 per frame, and the
+            // smear one-pole rings on after the last decoded hop.
+            const auto concealFrames = value("packetLoss") > 0.0f ? decaySteps(0.7f) : 0;
+            const auto smear = value("smear") * 0.01f;
+            return (concealFrames + 1) * sagMdctSize + decaySteps(1.0f - juce::jmap(smear, 0.45f, 0.03f));
+        }
+        case 6:
+        {
+            // Freezes never outlive a referenceBlockSize grid cell; a hold can follow for up to twice holdBase.
+            constexpr std::array<int, 6> clusterSizes { 1, 2, 4, 8, 16, 32 };
+            const auto clusterSize = clusterSizes[(size_t) juce::jlimit(0, 5, static_cast<int>(value("cluster")))];
+            const auto holdBase = clusterSize * juce::jmax(1, static_cast<int>(1 + value("binDensity") * 0.1f));
+            return referenceBlockSize + 2 * holdBase;
+        }
+        case 7:
+        {
+            // Furthest read offset into the delay line, plus the longest stall hold.
+            const auto spikeMax = juce::jmax(1, static_cast<int>(2 + value("latencySpike") * 1.8f + value("thermal") * 0.8f));
+            const auto baseDesync = static_cast<int>(value("desync") * 1.2f);
+            return spikeMax + juce::jmax(1, baseDesync) + 22;
+        }
+        case 8:
+            // The micro-loop replays its last loopLength samples.
+            return juce::jlimit(16, juce::jmax(16, static_cast<int>(0.08 * currentSampleRate)),
+                                static_cast<int>(std::round(value("loopMs") * 0.001 * currentSampleRate)));
+        case 9:
+        {
+            // A slice captured just before the input stopped plays back `repeats` times.
+            const auto sliceLength = juce::jlimit(16, juce::jmax(64, static_cast<int>(0.5 * currentSampleRate)),
+                                                  static_cast<int>(std::round(value("sliceMs") * 0.001 * currentSampleRate)));
+            const auto repeats = juce::jmax(1, static_cast<int>(std::round(value("repeats"))));
+            return sliceLength * (repeats + 1);
+        }
+        case 10:
+            // Jumps can land anywhere in the 2.5 s history, and the blur filter rings on after it.
+            return mskBuffer[0].size() + decaySteps(juce::jmap(value("blur") * 0.01f, 0.92f, 0.28f));
+        default:
+            return 0;
+    }
+}
+
+bool DigitalisAudioProcessor::engineStateIsQuiet(int engine) const
+{
+    switch (engine)
+    {
+        case 2:
+            return isQuiet(nyqState.feedbackState) && isQuiet(nyqState.feedbackToneState)
+                && isQuiet(nyqState.heldCurrent) && isQuiet(nyqState.heldPrevious)
+                && nyqFadePos >= nyqLatency + nyqFadeSamples;
+        case 5: return isQuiet(sagSmearState);
+        case 10: return isQuiet(mskBlurState);
+        default: return true;
+    }
+}
+
+bool DigitalisAudioProcessor::engineGeneratesFromSilence(int engine) const
+{
+    switch (engine)
+    {
+        case 1: return parameters.getRawParameterValue("denormal")->load() > 0.0f; // bursts fire on near-silent samples
+        case 5: return parameters.getRawParameterValue("packetLoss")->load() > 0.0f
+                    && parameters.getRawParameterValue("masking")->load() > 0.0f; // concealment noise on lost frames
+        default: return false;
     }
+}
 
-    if (kPluginIndex == 9)
+DigitalisAudioProcessor::QualityTier DigitalisAudioProcessor::selectQualityTier() const
+{
+    switch (static_cast<int>(parameters.getRawParameterValue("quality")->load()))
     {
-        return {
-            make("Init", {{ "amount", 28.0f }, { "rateHz", 4.5f }, { "sliceMs", 36.0f }, { "repeats", 3.0f }, { "reverse", 6.0f }, { "timingJitter", 4.0f }, { "duck", 22.0f }, { "mix", 100.0f }, { "autolevel", 50.0f }, { "safety", 66.0f }, { "output", -10.0f } }),
-            make("Safe Mix", {{ "amount", 36.0f }, { "rateHz", 5.2f }, { "sliceMs", 42.0f }, { "repeats", 4.0f }, { "reverse", 10.0f }, { "timingJitter", 8.0f }, { "duck", 28.0f }, { "mix", 32.0f }, { "autolevel", 54.0f }, { "safety", 71.0f }, { "output", -1.6f } }),
-            make("Subtle Tape Twitch", {{ "amount", 40.0f }, { "rateHz", 4.0f }, { "sliceMs", 48.0f }, { "repeats", 3.0f }, { "reverse", 12.0f }, { "timingJitter", 10.0f }, { "duck", 24.0f }, { "mix", 48.0f }, { "autolevel", 53.0f }, { "safety", 70.0f }, { "output", -1.5f } }),
-            make("Subtle Chop Drift", {{ "amount", 44.0f }, { "rateHz", 6.2f }, { "sliceMs", 30.0f }, { "repeats", 4.0f }, { "reverse", 18.0f }, { "timingJitter", 14.0f }, { "duck", 30.0f }, { "mix", 52.0f }, { "autolevel", 52.0f }, { "safety", 70.0f }, { "output", -1.6f } }),
-            make("Medium Gate Repeat", {{ "amount", 62.0f }, { "rateHz", 8.0f }, { "sliceMs", 24.0f }, { "repeats", 6.0f }, { "reverse", 20.0f }, { "timingJitter", 16.0f }, { "duck", 42.0f }, { "mix", 74.0f }, { "autolevel", 50.0f }, { "safety", 73.0f }, { "output", -2.2f } }),
-            make("Medium Vinyl Skip", {{ "amount", 68.0f }, { "rateHz", 10.0f }, { "sliceMs", 18.0f }, { "repeats", 7.0f }, { "reverse", 30.0f }, { "timingJitter", 24.0f }, { "duck", 48.0f }, { "mix", 78.0f }, { "autolevel", 49.0f }, { "safety", 74.0f }, { "output", -2.4f } }),
-            make("Extreme Machine Gun", {{ "amount", 92.0f }, { "rateHz", 16.0f }, { "sliceMs", 12.0f }, { "repeats", 12.0f }, { "reverse", 24.0f }, { "timingJitter", 20.0f }, { "duck", 64.0f }, { "mix", 100.0f }, { "autolevel", 45.0f }, { "safety", 80.0f }, { "output", -3.2f } }),
-            make("Extreme Reverse Shred", {{ "amount", 96.0f }, { "rateHz", 14.0f }, { "sliceMs", 14.0f }, { "repeats", 14.0f }, { "reverse", 86.0f }, { "timingJitter", 28.0f }, { "duck", 72.0f }, { "mix", 100.0f }, { "autolevel", 43.0f }, { "safety", 82.0f }, { "output", -3.8f } }),
-            make("Rhythmic 16th Chop", {{ "amount", 78.0f }, { "rateHz", 8.0f }, { "sliceMs", 22.0f }, { "repeats", 8.0f }, { "reverse", 14.0f }, { "timingJitter", 8.0f }, { "duck", 52.0f }, { "mix", 84.0f }, { "autolevel", 48.0f }, { "safety", 76.0f }, { "output", -2.6f } }),
-            make("Rhythmic Triplet Jam", {{ "amount", 82.0f }, { "rateHz", 6.0f }, { "sliceMs", 28.0f }, { "repeats", 9.0f }, { "reverse", 22.0f }, { "timingJitter", 12.0f }, { "duck", 56.0f }, { "mix", 86.0f }, { "autolevel", 47.0f }, { "safety", 77.0f }, { "output", -2.8f } })
-        };
+        case 1: return QualityTier::draft;
+        case 2: return QualityTier::high;
+        default: return isNonRealtime() ? QualityTier::high : QualityTier::draft;
     }
+}
+
+float DigitalisAudioProcessor::saturate(float x) const noexcept
+{
+    if (qualityTier == QualityTier::high)
+        return std::tanh(x);
+
+    // Pade approximant: within 2e-5 of tanh up to |x| = 4 and 1e-4 at the clamp, so a tier change
+    // does not step the output.
+    return juce::jlimit(-1.0f, 1.0f, juce::dsp::FastMathApproximations::tanh(juce::jlimit(-5.0f, 5.0f, x)));
+}
 
-    if (kPluginIndex == 10)
+void DigitalisAudioProcessor::saturateBlock(float* data, int numSamples) const noexcept
+{
+    if (qualityTier == QualityTier::high)
     {
-        return {
-            make("Init", {{ "skip", 80.0f }, { "jumpRate", 3.8f }, { "segMs", 220.0f }, { "melody", 60.0f }, { "spread", 72.0f }, { "reverse", 34.0f }, { "flutter", 46.0f }, { "blur", 14.0f }, { "mix", 100.0f }, { "autolevel", 47.0f }, { "safety", 68.0f }, { "output", -10.7f } }),
-            make("Safe Mix", {{ "skip", 42.0f }, { "jumpRate", 4.8f }, { "segMs", 46.0f }, { "melody", 46.0f }, { "spread", 44.0f }, { "reverse", 14.0f }, { "flutter", 12.0f }, { "blur", 24.0f }, { "mix", 30.0f }, { "autolevel", 52.0f }, { "safety", 71.0f }, { "output", -1.8f } }),
-            make("Subtle Disk Fray", {{ "skip", 48.0f }, { "jumpRate", 5.6f }, { "segMs", 34.0f }, { "melody", 52.0f }, { "spread", 42.0f }, { "reverse", 16.0f }, { "flutter", 16.0f }, { "blur", 26.0f }, { "mix", 46.0f }, { "autolevel", 50.0f }, { "safety", 72.0f }, { "output", -1.7f } }),
-            make("Subtle Pitch Skips", {{ "skip", 54.0f }, { "jumpRate", 6.2f }, { "segMs", 30.0f }, { "melody", 62.0f }, { "spread", 58.0f }, { "reverse", 18.0f }, { "flutter", 20.0f }, { "blur", 28.0f }, { "mix", 52.0f }, { "autolevel", 49.0f }, { "safety", 72.0f }, { "output", -1.9f } }),
-            make("Medium Oval Cutups", {{ "skip", 68.0f }, { "jumpRate", 7.8f }, { "segMs", 24.0f }, { "melody", 72.0f }, { "spread", 68.0f }, { "reverse", 22.0f }, { "flutter", 24.0f }, { "blur", 34.0f }, { "mix", 74.0f }, { "autolevel", 47.0f }, { "safety", 74.0f }, { "output", -2.4f } }),
-            make("Medium Overcomes Drift", {{ "skip", 74.0f }, { "jumpRate", 8.5f }, { "segMs", 22.0f }, { "melody", 80.0f }, { "spread", 76.0f }, { "reverse", 26.0f }, { "flutter", 30.0f }, { "blur", 36.0f }, { "mix", 78.0f }, { "autolevel", 46.0f }, { "safety", 75.0f }, { "output", -2.6f } }),
-            make("Extreme CD Collapse", {{ "skip", 94.0f }, { "jumpRate", 12.0f }, { "segMs", 16.0f }, { "melody", 92.0f }, { "spread", 88.0f }, { "reverse", 34.0f }, { "flutter", 42.0f }, { "blur", 44.0f }, { "mix", 100.0f }, { "autolevel", 42.0f }, { "safety", 80.0f }, { "output", -3.4f } }),
-            make("Extreme Melodic Shatter", {{ "skip", 98.0f }, { "jumpRate", 14.5f }, { "segMs", 12.0f }, { "melody", 100.0f }, { "spread", 96.0f }, { "reverse", 52.0f }, { "flutter", 52.0f }, { "blur", 48.0f }, { "mix", 100.0f }, { "autolevel", 40.0f }, { "safety", 83.0f }, { "output", -3.9f } }),
-            make("Rhythmic Quarter Skip", {{ "skip", 76.0f }, { "jumpRate", 4.0f }, { "segMs", 36.0f }, { "melody", 70.0f }, { "spread", 64.0f }, { "reverse", 16.0f }, { "flutter", 20.0f }, { "blur", 30.0f }, { "mix", 82.0f }, { "autolevel", 45.0f }, { "safety", 77.0f }, { "output", -2.8f } }),
-            make("Rhythmic Trip Skipline", {{ "skip", 82.0f }, { "jumpRate", 6.0f }, { "segMs", 26.0f }, { "melody", 84.0f }, { "spread", 78.0f }, { "reverse", 24.0f }, { "flutter", 28.0f }, { "blur", 34.0f }, { "mix", 86.0f }, { "autolevel", 44.0f }, { "safety", 78.0f }, { "output", -3.0f } })
-        };
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = std::tanh(data[i]);
+        return;
     }
 
-    return { make("Init", {{ "digital", 0.0f }, { "mix", 100.0f }, { "autolevel", defaultAutoLevelPercent() }, { "safety", defaultSafetyPercent() }, { "output", defaultOutputTrimDb() } }) };
+    digitalis::kernels().saturateDraft(data, numSamples);
 }
 
-void DigitalisAudioProcessor::applyFactoryPreset(size_t index)
+void DigitalisAudioProcessor::setLimiterActive(bool shouldBeActive)
 {
-    if (factoryPresets.empty())
-        return;
+    // The delay line keeps running either way, so switching only restarts the gain detector and
+    // neither the latency nor the audio in flight changes.
+    limiterActive = shouldBeActive;
+    resetLimiterDetector();
+}
 
-    const auto clamped = juce::jmin(index, factoryPresets.size() - 1);
-    const auto& preset = factoryPresets[clamped];
+void DigitalisAudioProcessor::updateReportedLatency()
+{
+    // The streaming codec delays its output by two MDCT hops and the pre-echo lookahead; report that
+    // and line the dry path up with it. The limiter's delay is counted whether or not it is on, so
+    // the latency only changes in prepareToPlay.
+    const auto runsCodec = (kPluginIndex == 5 || kPluginIndex == kChainPluginIndex);
+    const auto wetLatency = (runsCodec ? sagLatencySamples : 0) + nyqLatency + limiterRamp + 1;
+    dryWet.setWetLatency(static_cast<float>(wetLatency));
+    setLatencySamples(wetLatency);
+}
 
-    for (const auto& pv : preset.values)
-    {
-        if (auto* p = parameters.getParameter(pv.id))
-            p->setValueNotifyingHost(p->convertTo0to1(pv.value));
-    }
+void DigitalisAudioProcessor::resetLimiter()
+{
+    for (auto& line : limiterDelay)
+        std::fill(line.begin(), line.end(), 0.0f);
 
-    currentProgramIndex = static_cast<int>(clamped);
+    limiterDelayPos = 0;
+    resetLimiterDetector();
 }
 
-void DigitalisAudioProcessor::applyPostSafety(juce::AudioBuffer<float>& buffer)
+void DigitalisAudioProcessor::resetLimiterDetector()
 {
-    const auto autoLevel = parameters.getRawParameterValue("autolevel")->load() * 0.01f;
-    const auto safety = parameters.getRawParameterValue("safety")->load() * 0.01f;
-    const auto outputTrimDb = parameters.getRawParameterValue("output")->load();
-    const auto outputGain = juce::Decibels::decibelsToGain(outputTrimDb);
+    for (auto& history : limiterHistory)
+        history.fill(0.0f);
+
+    std::fill(limiterGainRing.begin(), limiterGainRing.end(), 1.0f);
+    limiterGainSum = static_cast<double>(limiterGainRing.size());
+    limiterGain = 1.0f;
+    limiterPeakHead = 0;
+    limiterPeakCount = 0;
+    limiterRampPos = 0;
+    limiterClock = 0;
+}
 
-    const auto channels = getTotalNumInputChannels();
+void DigitalisAudioProcessor::applyLimiterDelay(juce::AudioBuffer<float>& buffer)
+{
+    const auto channels = juce::jmin(2, getTotalNumInputChannels());
     const auto numSamples = buffer.getNumSamples();
+    const auto delayLength = limiterRamp + 1;
+    auto pos = limiterDelayPos;
 
-    auto sumSq = 0.0f;
-    auto count = 0;
     for (int ch = 0; ch < channels; ++ch)
     {
-        const auto* read = buffer.getReadPointer(ch);
+        auto& line = limiterDelay[(size_t) ch];
+        auto* write = buffer.getWritePointer(ch);
+        pos = limiterDelayPos;
+
         for (int i = 0; i < numSamples; ++i)
         {
-            sumSq += read[i] * read[i];
-            ++count;
+            const auto delayed = line[(size_t) pos];
+            line[(size_t) pos] = write[i];
+            write[i] = delayed;
+            pos = pos + 1 < delayLength ? pos + 1 : 0;
         }
     }
 
-    const auto rms = std::sqrt(sumSq / static_cast<float>(juce::jmax(1, count)));
-    const auto targetRms = targetRmsForPlugin();
-    const auto compensation = juce::jlimit(0.25f, 4.0f, targetRms / (rms + 1.0e-6f));
-    postAutoLevelGain += (compensation - postAutoLevelGain) * 0.02f;
-    const auto gain = outputGain * juce::jmap(autoLevel, 1.0f, postAutoLevelGain);
+    limiterDelayPos = pos;
+}
 
-    const auto dcR = 0.995f;
-    const auto drive = juce::jmap(safety, 1.0f, 4.2f);
-    const auto softNorm = 1.0f / std::tanh(drive);
-    const auto hardLimit = juce::jmap(safety, 0.995f, 0.8f);
+void DigitalisAudioProcessor::applyLookaheadLimiter(juce::AudioBuffer<float>& buffer, float ceiling)
+{
+    const auto channels = juce::jmin(2, getTotalNumInputChannels());
+    const auto numSamples = buffer.getNumSamples();
 
-    for (int ch = 0; ch < channels; ++ch)
+    // Peak p[n] covers x[n] and the interpolated segment x[n-2]..x[n-1]. Holding the maximum over
+    // ramp + 2 samples and averaging the gain over ramp samples guarantees that the sample leaving
+    // the delay, and both segments either side of it, sit under the ceiling.
+    const auto window = static_cast<std::uint32_t>(limiterRamp + 2);
+    const auto capacity = limiterRamp + 2;
+    const auto delayLength = limiterRamp + 1;
+    const auto invRamp = 1.0 / static_cast<double>(limiterRamp);
+    const auto releaseCoeff = 1.0f - std::exp(-1.0f / (0.06f * static_cast<float>(currentSampleRate)));
+
+    for (int i = 0; i < numSamples; ++i)
     {
-        const auto c = static_cast<size_t>(ch);
-        auto* write = buffer.getWritePointer(ch);
+        auto peak = 0.0f;
 
-        for (int i = 0; i < numSamples; ++i)
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const auto c = static_cast<size_t>(ch);
+            auto& h = limiterHistory[c];
+            const auto x = buffer.getSample(ch, i);
+
+            peak = juce::jmax(peak, std::abs(x), interSamplePeak(h[0], h[1], h[2], x));
+            h = { h[1], h[2], x };
+        }
+
+        // Sliding maximum: values are kept decreasing from the front, so each sample is pushed and
+        // popped at most once.
+        if (limiterPeakCount > 0 && limiterClock - limiterPeakTimes[(size_t) limiterPeakHead] >= window)
+        {
+            limiterPeakHead = (limiterPeakHead + 1) % capacity;
+            --limiterPeakCount;
+        }
+
+        while (limiterPeakCount > 0)
         {
-            auto x = write[i];
-            const auto dc = x - postDcPrevInput[c] + dcR * postDcPrevOutput[c];
-            postDcPrevInput[c] = x;
-            postDcPrevOutput[c] = dc;
+            const auto back = (limiterPeakHead + limiterPeakCount - 1) % capacity;
+            if (limiterPeakValues[(size_t) back] > peak)
+                break;
+
+            --limiterPeakCount;
+        }
 
-            auto y = dc * gain;
-            y = std::tanh(y * drive) * softNorm;
-            y = juce::jlimit(-hardLimit, hardLimit, y);
-            write[i] = y;
+        const auto slot = (size_t) ((limiterPeakHead + limiterPeakCount) % capacity);
+        limiterPeakValues[slot] = peak;
+        limiterPeakTimes[slot] = limiterClock++;
+        ++limiterPeakCount;
+
+        const auto heldPeak = limiterPeakValues[(size_t) limiterPeakHead];
+        const auto target = heldPeak > ceiling ? ceiling / heldPeak : 1.0f;
+
+        limiterGainSum += static_cast<double>(target - limiterGainRing[(size_t) limiterRampPos]);
+        limiterGainRing[(size_t) limiterRampPos] = target;
+        limiterRampPos = (limiterRampPos + 1) % limiterRamp;
+
+        const auto ramped = static_cast<float>(limiterGainSum * invRamp);
+        limiterGain = ramped < limiterGain ? ramped : limiterGain + (ramped - limiterGain) * releaseCoeff;
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            auto& line = limiterDelay[(size_t) ch];
+            const auto delayed = line[(size_t) limiterDelayPos];
+            line[(size_t) limiterDelayPos] = buffer.getSample(ch, i);
+            buffer.setSample(ch, i, juce::jlimit(-ceiling, ceiling, delayed * limiterGain));
         }
+
+        limiterDelayPos = (limiterDelayPos + 1) % delayLength;
     }
 }
 
@@ -903,24 +1986,38 @@ void DigitalisAudioProcessor::processFloatingPointCollapse(juce::AudioBuffer<flo
 
         int sharedExponent = 0;
         std::frexp(peak + 1.0e-20f, &sharedExponent);
+        const auto toBlockScale = std::ldexp(1.0f, -sharedExponent);
+        const auto fromBlockScale = std::ldexp(1.0f, sharedExponent);
+        const auto& vector = digitalis::kernels();
 
+        // The stages that carry state or draw random numbers run per sample; the block-float,
+        // mantissa and exponent quantisers in between run over the whole chunk at once.
         for (int ch = 0; ch < numInputChannels; ++ch)
         {
             auto* write = buffer.getWritePointer(ch, start);
             for (int i = 0; i < chunkSize; ++i)
             {
-                auto x = write[i] * driveGain;
-
                 if (--fpcTemporalCountdown[(size_t) ch] <= 0)
                 {
-                    fpcTemporalHeld[(size_t) ch] = x;
+                    fpcTemporalHeld[(size_t) ch] = write[i] * driveGain;
                     fpcTemporalCountdown[(size_t) ch] = temporalHoldSamples;
                 }
-                x = fpcTemporalHeld[(size_t) ch];
+                write[i] = fpcTemporalHeld[(size_t) ch];
+            }
+
+            juce::FloatVectorOperations::multiply(write, toBlockScale, chunkSize);
+            vector.quantise(write, chunkSize, blockMantissaSteps);
+            juce::FloatVectorOperations::multiply(write, fromBlockScale, chunkSize);
+
+            for (int i = 0; i < chunkSize; ++i)
+                write[i] = applyRoundingChaos(write[i], roundingAmount + collapse * 0.35f);
 
-                x = std::ldexp(quantise(std::ldexp(x, -sharedExponent), blockMantissaSteps), sharedExponent);
-                x = applyFloatDamage(x, mantissaBits, exponentStep, roundingAmount + collapse * 0.35f);
-                x = applyNonlinearQuantiser(x, quantCurve, collapse);
+            vector.truncateMantissa(write, chunkSize, mantissaBits);
+            vector.quantiseExponent(write, chunkSize, exponentStep);
+
+            for (int i = 0; i < chunkSize; ++i)
+            {
+                auto x = applyNonlinearQuantiser(write[i], quantCurve, collapse);
 
                 if (denormalBurstRemaining > 0)
                 {
@@ -940,6 +2037,14 @@ void DigitalisAudioProcessor::processFloatingPointCollapse(juce::AudioBuffer<flo
 }
 
 float DigitalisAudioProcessor::applyFloatDamage(float x, int mantissaBits, int exponentStep, float roundingAmount)
+{
+    x = applyRoundingChaos(x, roundingAmount);
+    x = truncateMantissa(x, mantissaBits);
+    x = quantiseExponent(x, exponentStep);
+    return x;
+}
+
+float DigitalisAudioProcessor::applyRoundingChaos(float x, float roundingAmount)
 {
     if (std::abs(x) < 1.0e-35f)
         return 0.0f;
@@ -954,8 +2059,6 @@ float DigitalisAudioProcessor::applyFloatDamage(float x, int mantissaBits, int e
             x = std::nextafterf(x, direction);
     }
 
-    x = truncateMantissa(x, mantissaBits);
-    x = quantiseExponent(x, exponentStep);
     return x;
 }
 
@@ -1002,6 +2105,91 @@ float DigitalisAudioProcessor::applyNonlinearQuantiser(float x, int mode, float
 }
 
 void DigitalisAudioProcessor::processNyquistDestroyer(juce::AudioBuffer<float>& buffer)
+{
+    const auto tier = qualityTier;
+    const auto numSamples = buffer.getNumSamples();
+
+    if (tier != nyqTier)
+    {
+        // The outgoing path keeps running from a copy of the state until the crossfade is done.
+        nyqFadeState = nyqState;
+        nyqFadeTier = nyqTier;
+        nyqFadePos = 0;
+        nyqTier = tier;
+
+        if (tier == QualityTier::high)
+            nyqOversampler->reset();
+        else
+            for (auto& line : nyqAlignDelay)
+                std::fill(line.begin(), line.end(), 0.0f);
+    }
+
+    const auto fading = nyqFadePos < nyqLatency + nyqFadeSamples && numSamples <= nyqFadeBuffer.getNumSamples();
+    const auto channels = juce::jmin(2, getTotalNumInputChannels());
+
+    const auto block = juce::dsp::AudioBlock<float>(buffer).getSubsetChannelBlock(0, (size_t) channels);
+    const auto outgoing = juce::dsp::AudioBlock<float>(nyqFadeBuffer).getSubsetChannelBlock(0, (size_t) channels).getSubBlock(0, (size_t) numSamples);
+
+    if (fading)
+        outgoing.copyFrom(block);
+
+    runNyquistTier(block, nyqState, tier);
+
+    if (fading)
+    {
+        runNyquistTier(outgoing, nyqFadeState, nyqFadeTier);
+
+        // The incoming path has just been reset, so it only fades in once its filters or delay
+        // hold real signal again.
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const auto t = juce::jlimit(0.0f, 1.0f, static_cast<float>(nyqFadePos + i - nyqLatency) / static_cast<float>(nyqFadeSamples));
+            for (int ch = 0; ch < channels; ++ch)
+                buffer.setSample(ch, i, juce::jmap(t, outgoing.getSample(ch, i), buffer.getSample(ch, i)));
+        }
+
+        nyqFadePos += numSamples;
+    }
+    else
+    {
+        nyqFadePos = nyqLatency + nyqFadeSamples;
+    }
+}
+
+void DigitalisAudioProcessor::runNyquistTier(juce::dsp::AudioBlock<float> block, NyquistState& nyq, QualityTier tier)
+{
+    if (tier == QualityTier::high && nyqOversampler != nullptr)
+    {
+        runNyquistCore(nyqOversampler->processSamplesUp(block), nyq, tier);
+        nyqOversampler->processSamplesDown(block);
+        return;
+    }
+
+    runNyquistCore(block, nyq, tier);
+
+    // Delay by the oversampler's latency so both tiers line up with the reported latency.
+    if (nyqLatency > 0)
+    {
+        const auto startPos = nyqAlignPos;
+        for (size_t ch = 0; ch < block.getNumChannels(); ++ch)
+        {
+            auto* data = block.getChannelPointer(ch);
+            auto& line = nyqAlignDelay[ch];
+            auto pos = startPos;
+
+            for (size_t i = 0; i < block.getNumSamples(); ++i)
+            {
+                std::swap(data[i], line[(size_t) pos]);
+                if (++pos == nyqLatency)
+                    pos = 0;
+            }
+
+            nyqAlignPos = pos;
+        }
+    }
+}
+
+void DigitalisAudioProcessor::runNyquistCore(const juce::dsp::AudioBlock<float>& block, NyquistState& nyq, QualityTier tier)
 {
     const auto destroy = parameters.getRawParameterValue("destroy")->load() * 0.01f;
     auto minSR = parameters.getRawParameterValue("minSR")->load();
@@ -1015,59 +2203,85 @@ void DigitalisAudioProcessor::processNyquistDestroyer(juce::AudioBuffer<float>&
     const auto transient = parameters.getRawParameterValue("transient")->load() * 0.01f;
     const auto feedback = parameters.getRawParameterValue("feedback")->load() * 0.01f;
     const auto feedbackTone = parameters.getRawParameterValue("fbTone")->load() * 0.01f;
-
-    const auto phaseInc = juce::MathConstants<float>::twoPi * modRate / static_cast<float>(currentSampleRate);
-    const auto inputChannels = getTotalNumInputChannels();
-    const auto samples = buffer.getNumSamples();
+    const auto bandLimit = 1.0f - parameters.getRawParameterValue("aliasAmt")->load() * 0.01f;
+    const auto& stepResidual = sharedTables->stepResidual;
+
+    // Per-sample coefficients were tuned at the host rate; rescale them when running oversampled.
+    const auto oversampling = tier == QualityTier::high && nyqOversampler != nullptr ? 2.0f : 1.0f;
+    const auto sampleRate = currentSampleRate * static_cast<double>(oversampling);
+    const auto perSample = [oversampling](float coeff) { return 1.0f - std::pow(1.0f - coeff, 1.0f / oversampling); };
+
+    // Draft tier updates the sweep and hold length at control rate; high tier every (oversampled) sample.
+    const auto modulationInterval = tier == QualityTier::high ? 1 : 16;
+    const auto phaseInc = juce::MathConstants<float>::twoPi * modRate / static_cast<float>(sampleRate);
+    const auto inputChannels = static_cast<int>(block.getNumChannels());
+    const auto samples = static_cast<int>(block.getNumSamples());
     const auto minHold = 1;
-    const auto maxHold = juce::jmax(2, static_cast<int>(currentSampleRate / 600.0));
+    const auto maxHold = juce::jmax(2, static_cast<int>(sampleRate / 600.0));
+    const auto attack = perSample(0.65f);
+    const auto release = 1.0f - perSample(1.0f - 0.9965f);
+    const auto toneCoeff = perSample(juce::jmap(feedbackTone, 0.015f, 0.65f));
+    const auto outDrive = juce::jmap(destroy, 1.0f, 2.6f);
+    const auto feedbackDrive = juce::jmap(destroy, 1.0f, 1.8f);
 
     for (int i = 0; i < samples; ++i)
     {
         auto energy = 0.0f;
         for (int ch = 0; ch < inputChannels; ++ch)
-            energy += std::abs(buffer.getSample(ch, i));
+            energy += std::abs(block.getSample(ch, i));
         energy /= static_cast<float>(juce::jmax(1, inputChannels));
 
-        const auto attack = 0.65f;
-        const auto release = 0.9965f;
-        nyqTransientEnv = energy > nyqTransientEnv ? (attack * energy + (1.0f - attack) * nyqTransientEnv)
-                                                   : (release * nyqTransientEnv + (1.0f - release) * energy);
+        nyq.transientEnv = followEnvelope(nyq.transientEnv, energy, attack, release);
 
-        const auto lfo = 0.5f + 0.5f * std::sin(nyqPhase);
-        nyqPhase += phaseInc;
-        if (nyqPhase > juce::MathConstants<float>::twoPi)
-            nyqPhase -= juce::MathConstants<float>::twoPi;
+        if (--nyq.modulationCountdown <= 0)
+        {
+            const auto lfo = 0.5f + 0.5f * std::sin(nyq.phase);
+            nyq.phase += phaseInc * static_cast<float>(modulationInterval);
+            if (nyq.phase > juce::MathConstants<float>::twoPi)
+                nyq.phase -= juce::MathConstants<float>::twoPi;
+
+            const auto sweep = juce::jmap(modDepth * lfo, maxSR, minSR);
+            const auto transientDrop = juce::jmap(transient * nyq.transientEnv, 1.0f, 0.08f);
+            const auto effectiveSR = juce::jlimit(750.0f, maxSR, sweep * transientDrop);
+            nyq.holdSamples = juce::jlimit(minHold, maxHold, static_cast<int>(std::round(sampleRate / effectiveSR)));
+            nyq.modulationCountdown = modulationInterval;
+        }
 
-        const auto sweep = juce::jmap(modDepth * lfo, maxSR, minSR);
-        const auto transientDrop = juce::jmap(transient * nyqTransientEnv, 1.0f, 0.08f);
-        const auto effectiveSR = juce::jlimit(750.0f, maxSR, sweep * transientDrop);
-        const auto holdSamples = juce::jlimit(minHold, maxHold, static_cast<int>(std::round(currentSampleRate / effectiveSR)));
+        const auto holdSamples = nyq.holdSamples;
 
         for (int ch = 0; ch < inputChannels; ++ch)
         {
             const auto c = static_cast<size_t>(ch);
-            auto in = buffer.getSample(ch, i);
-            in += nyqFeedbackState[c] * feedback;
+            auto in = block.getSample(ch, i);
+            in += nyq.feedbackState[c] * feedback;
+
+            auto& blepRing = nyq.blepRing[c];
+            auto& blepPos = nyq.blepPos[c];
 
-            if (--nyqHoldCounter[c] <= 0)
+            if (--nyq.holdCounter[c] <= 0)
             {
-                nyqHeldPrevious[c] = nyqHeldCurrent[c];
-                nyqHeldCurrent[c] = in;
-                nyqHoldCounter[c] = holdSamples;
+                const auto step = in - nyq.heldCurrent[c];
+                for (int k = 0; k < nyqBlepLength; ++k)
+                    blepRing[(size_t) ((blepPos + k) & (nyqBlepLength - 1))] += step * stepResidual[(size_t) k];
+
+                nyq.heldPrevious[c] = nyq.heldCurrent[c];
+                nyq.heldCurrent[c] = in;
+                nyq.holdCounter[c] = holdSamples;
             }
 
-            const auto held = nyqHeldCurrent[c];
-            const auto frac = 1.0f - (static_cast<float>(nyqHoldCounter[c]) / static_cast<float>(juce::jmax(1, holdSamples)));
+            // Alias Amount crossfades from the band-limited step (0%) to the raw one (100%).
+            const auto held = nyq.heldCurrent[c] + bandLimit * std::exchange(blepRing[(size_t) blepPos], 0.0f);
+            blepPos = (blepPos + 1) & (nyqBlepLength - 1);
+            const auto frac = 1.0f - (static_cast<float>(nyq.holdCounter[c]) / static_cast<float>(juce::jmax(1, holdSamples)));
             const auto warpedFrac = juce::jlimit(0.0f, 1.0f, frac + (random.nextFloat() * 2.0f - 1.0f) * interpErr * 0.9f);
-            const auto wrongLinear = juce::jmap(warpedFrac, nyqHeldPrevious[c], nyqHeldCurrent[c]);
+            const auto wrongLinear = juce::jmap(warpedFrac, nyq.heldPrevious[c], nyq.heldCurrent[c]);
             auto out = juce::jmap(interpErr, held, wrongLinear);
 
-            out = std::tanh(out * juce::jmap(destroy, 1.0f, 2.6f));
-            nyqFeedbackToneState[c] += (out - nyqFeedbackToneState[c]) * juce::jmap(feedbackTone, 0.015f, 0.65f);
-            nyqFeedbackState[c] = std::tanh(nyqFeedbackToneState[c] * juce::jmap(destroy, 1.0f, 1.8f));
+            out = saturate(out * outDrive);
+            nyq.feedbackToneState[c] += (out - nyq.feedbackToneState[c]) * toneCoeff;
+            nyq.feedbackState[c] = saturate(nyq.feedbackToneState[c] * feedbackDrive);
 
-            buffer.setSample(ch, i, out);
+            block.setSample(ch, i, out);
         }
     }
 }
@@ -1109,12 +2323,12 @@ void DigitalisAudioProcessor::processBufferGlitchEngine(juce::AudioBuffer<float>
         {
             const auto c = static_cast<size_t>(ch);
             auto* write = buffer.getWritePointer(ch, start);
-            std::vector<float> chunk((size_t) chunkSize, 0.0f);
+            auto& chunk = bgeChunk;
             for (int i = 0; i < chunkSize; ++i)
                 chunk[(size_t) i] = write[i];
 
             if (reorderMode == 2)
-                std::reverse(chunk.begin(), chunk.end());
+                std::reverse(chunk.begin(), chunk.begin() + chunkSize);
 
             if (dropCount > 0)
             {
@@ -1149,8 +2363,6 @@ void DigitalisAudioProcessor::processBufferGlitchEngine(juce::AudioBuffer<float>
             for (int i = 0; i < chunkSize; ++i)
                 write[i] = chunk[(size_t) i];
 
-            if ((int) bgePrevChunk[c].size() < chunkSize)
-                bgePrevChunk[c].resize((size_t) chunkSize, 0.0f);
             for (int i = 0; i < chunkSize; ++i)
                 bgePrevChunk[c][(size_t) i] = chunk[(size_t) i];
         }
@@ -1173,8 +2385,7 @@ void DigitalisAudioProcessor::processBufferGlitchEngine(juce::AudioBuffer<float>
         {
             const auto x = write[i];
             const auto mag = std::abs(x);
-            bgeEnvelope[c] = mag > bgeEnvelope[c] ? (attack * mag + (1.0f - attack) * bgeEnvelope[c])
-                                                  : (release * bgeEnvelope[c] + (1.0f - release) * mag);
+            bgeEnvelope[c] = followEnvelope(bgeEnvelope[c], mag, attack, release);
 
             auto envForGain = bgeEnvelope[c];
             if (random.nextFloat() < lookFail * 0.08f)
@@ -1189,8 +2400,10 @@ void DigitalisAudioProcessor::processBufferGlitchEngine(juce::AudioBuffer<float>
             auto y = x * juce::jlimit(0.05f, 1.0f, gain);
             if (random.nextFloat() < lookFail * stress * 0.015f)
                 y = 0.0f;
-            write[i] = std::tanh(y * juce::jmap(stress, 1.0f, 1.6f));
+            write[i] = y * juce::jmap(stress, 1.0f, 1.6f);
         }
+
+        saturateBlock(write, numSamples);
     }
 }
 
@@ -1207,199 +2420,577 @@ void DigitalisAudioProcessor::processAutomationQuantiser(juce::AudioBuffer<float
     constexpr std::array<int, 8> stepDivs { 1, 2, 4, 8, 16, 32, 64, 128 };
     const auto stepDiv = stepDivs[(size_t) juce::jlimit(0, 7, stepDivChoice)];
 
+    const auto beatSynced = gridMode == 2;
     auto holdSamples = 1;
     if (gridMode == 0)
     {
-        holdSamples = juce::jmax(1, maxBlockSize / juce::jmax(1, stepDiv / 2));
+        holdSamples = juce::jmax(1, referenceBlockSize / juce::jmax(1, stepDiv / 2));
     }
     else if (gridMode == 1)
     {
         holdSamples = stepDiv;
     }
-    else
-    {
-        // Beat-like lock fallback without host BPM: derive a stable musical clock from samplerate.
-        const auto pseudoBeatHz = 2.0f; // 120 BPM quarter-note
-        holdSamples = juce::jmax(1, static_cast<int>(std::round(currentSampleRate / (pseudoBeatHz * static_cast<float>(stepDiv)))));
-    }
 
     const auto channels = getTotalNumInputChannels();
     const auto samples = buffer.getNumSamples();
+
+    // Beat grid: steps sit on PPQ multiples of 1 / stepDiv quarter notes. The transport is read once per
+    // block and every boundary inside the block is derived from that snapshot, so offline renders stay
+    // in phase however fast they run. Each block re-anchors on the host PPQ, so tempo ramps never drift
+    // by more than one block. A position jump larger than half a step (loop, relocate) restarts the grid.
+    // Without a running transport the grid free-runs from the last known position.
+    auto beatStepPos = 0.0;
+    auto samplesPerStep = 1.0;
+    if (beatSynced)
+    {
+        auto bpm = 120.0;
+        auto ppq = aqBeatFreePpq;
+
+        if (auto* hostPlayHead = getPlayHead())
+        {
+            if (const auto position = hostPlayHead->getPosition())
+            {
+                if (const auto hostBpm = position->getBpm(); hostBpm.hasValue() && *hostBpm > 1.0)
+                    bpm = *hostBpm;
+
+                if (const auto hostPpq = position->getPpqPosition(); hostPpq.hasValue() && position->getIsPlaying())
+                {
+                    ppq = *hostPpq;
+                }
+            }
+        }
+
+        samplesPerStep = juce::jmax(1.0, currentSampleRate * 60.0 / (bpm * static_cast<double>(stepDiv)));
+        beatStepPos = ppq * static_cast<double>(stepDiv);
+
+        if (aqBeatNeedsSync || std::abs(beatStepPos - aqBeatExpectedPos) > 0.5)
+        {
+            aqBeatNextStep.fill(static_cast<juce::int64>(std::ceil(beatStepPos)));
+            aqBeatJitter = { 0, 0 };
+            aqBeatNeedsSync = false;
+        }
+
+        aqBeatExpectedPos = beatStepPos + static_cast<double>(samples) / samplesPerStep;
+        aqBeatFreePpq = aqBeatExpectedPos / static_cast<double>(stepDiv);
+    }
+
     const auto quantLevels = juce::jmax(2, static_cast<int>(std::round(juce::jmap(brutal, static_cast<float>(levels), juce::jmax(2.0f, static_cast<float>(levels) * 0.2f)))));
     const auto lfoRate = juce::jmap(brutal, 1.0f, 42.0f);
+    const auto modulationDepth = juce::jmap(brutal, 0.2f, 1.0f);
+    const auto zipperGain = zipper * juce::jmap(brutal, 0.3f, 0.9f);
+    const auto drive = juce::jmap(brutal, 1.2f, 3.2f);
+
+    auto nextStepAmp = [&](size_t c)
+    {
+        const auto phaseStep = juce::MathConstants<float>::twoPi * lfoRate / static_cast<float>(currentSampleRate);
+        aqLfoPhase[c] += phaseStep;
+        if (aqLfoPhase[c] > juce::MathConstants<float>::twoPi)
+            aqLfoPhase[c] -= juce::MathConstants<float>::twoPi;
+
+        if (phaseLock > 0.0f)
+        {
+            const auto lockStep = juce::MathConstants<float>::twoPi / static_cast<float>(juce::jmax(1, stepDiv));
+            const auto snapped = std::round(aqLfoPhase[c] / lockStep) * lockStep;
+            aqLfoPhase[c] = juce::jmap(phaseLock, aqLfoPhase[c], snapped);
+        }
+
+        auto amp = 0.5f + 0.5f * std::sin(aqLfoPhase[c]);
+        amp = std::round(amp * static_cast<float>(quantLevels - 1)) / static_cast<float>(quantLevels - 1);
+
+        if (jitter > 0.0f)
+            amp = juce::jlimit(0.0f, 1.0f, amp + (random.nextFloat() * 2.0f - 1.0f) * jitter * 0.06f);
+
+        return amp;
+    };
+
+    auto jitterOffset = [&](double span)
+    {
+        if (jitter <= 0.0f)
+            return 0;
+
+        return static_cast<int>(std::round((random.nextFloat() * 2.0f - 1.0f) * jitter * 0.35f * static_cast<float>(span)));
+    };
+
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        const auto c = static_cast<size_t>(ch);
+        auto* write = buffer.getWritePointer(ch);
+
+        auto renderHeld = [&](int from, int to)
+        {
+            const auto modulation = juce::jmap(modulationDepth, 1.0f, aqHeldAmp[c]);
+            for (int i = from; i < to; ++i)
+                write[i] = write[i] * modulation * drive;
+            saturateBlock(write + from, to - from);
+        };
+
+        auto start = 0;
+        while (start < samples)
+        {
+            auto stepAt = start + aqHeldCounter[c] - 1;
+            if (beatSynced)
+            {
+                const auto gridOffset = (static_cast<double>(aqBeatNextStep[c]) - beatStepPos) * samplesPerStep + aqBeatJitter[c];
+                stepAt = juce::jmax(start, static_cast<int>(std::round(juce::jmin(gridOffset, static_cast<double>(samples)))));
+            }
+
+            if (stepAt >= samples)
+            {
+                renderHeld(start, samples);
+                if (! beatSynced)
+                    aqHeldCounter[c] -= samples - start;
+                break;
+            }
+
+            renderHeld(start, stepAt);
+
+            const auto prevAmp = aqHeldAmp[c];
+            aqHeldAmp[c] = nextStepAmp(c);
+
+            const auto modulation = juce::jmap(modulationDepth, 1.0f, aqHeldAmp[c]);
+            auto y = write[stepAt] * modulation;
+            y += (aqHeldAmp[c] - prevAmp) * zipperGain * std::copysign(1.0f, y == 0.0f ? 1.0f : y);
+            write[stepAt] = saturate(y * drive);
+
+            if (beatSynced)
+            {
+                ++aqBeatNextStep[c];
+                aqBeatJitter[c] = jitterOffset(samplesPerStep);
+            }
+            else
+            {
+                aqHeldCounter[c] = juce::jmax(1, holdSamples + jitterOffset(holdSamples));
+            }
+
+            start = stepAt + 1;
+        }
+    }
+}
+
+void DigitalisAudioProcessor::processStreamingArtifactGenerator(juce::AudioBuffer<float>& buffer, bool codecEnabled)
+{
+    const auto artifact = parameters.getRawParameterValue("artifact")->load() * 0.01f;
+    const auto bitrate = parameters.getRawParameterValue("bitrate")->load();
+    const auto masking = parameters.getRawParameterValue("masking")->load() * 0.01f;
+    const auto smear = parameters.getRawParameterValue("smear")->load() * 0.01f;
+    const auto codecMode = static_cast<int>(parameters.getRawParameterValue("codecMode")->load());
+    const auto switchMs = parameters.getRawParameterValue("switchMs")->load();
+    const auto packetLoss = parameters.getRawParameterValue("packetLoss")->load() * 0.01f;
+    const auto burst = parameters.getRawParameterValue("burst")->load() * 0.01f;
+    const auto preEcho = parameters.getRawParameterValue("preecho")->load() * 0.01f;
+
+    // A burst leaks into the sample t before it at 1 / t of its level.
+    constexpr auto preEchoWeights = []
+    {
+        std::array<float, sagPreEchoTaps> weights {};
+        for (int t = 1; t <= sagPreEchoTaps; ++t)
+            weights[(size_t) t - 1] = 1.0f / static_cast<float>(t);
+        return weights;
+    }();
+
+    const auto channels = getTotalNumInputChannels();
+    const auto numSamples = buffer.getNumSamples();
+    const auto switchSamples = juce::jmax(1, static_cast<int>(std::round((switchMs * 0.001f) * static_cast<float>(currentSampleRate))));
+    const auto binsPerHz = static_cast<float>(sagMdctSize) / static_cast<float>(0.5 * currentSampleRate);
+    const auto concealNoise = juce::jmap(masking, 0.0f, 1.0f, 0.0f, 0.04f) * std::sqrt(static_cast<float>(sagMdctSize));
+    const auto absoluteFloorDb = 20.0f * std::log10(5.0e-5f * static_cast<float>(sagMdctSize));
+    const auto maskingOffsetDb = juce::jmap(masking, 30.0f, 6.0f);
+
+    // One frame of a transform codec: band energies, a spreading-function masking threshold, a
+    // greedy bit allocation against the per-frame budget, then quantisation per band.
+    // The codec flavours differ in bandwidth, efficiency, dead zone and what they do with bands
+    // that get no bits.
+    auto encodeFrame = [&](float* coeffs, int codec, juce::Random& rng)
+    {
+        auto cutoffHz = 3400.0f;
+        auto budgetScale = juce::jmin(1.0f, 13.0f / bitrate);
+        auto deadZone = 0.25f;
+        auto noiseFill = false;
+        auto keepEnergy = false;
+
+        switch (codec)
+        {
+            case 0: // MP3-ish: hard lowpass at low rates, starved bands left empty.
+                cutoffHz = juce::jmap(bitrate, 8.0f, 320.0f, 4500.0f, 19000.0f);
+                budgetScale = 1.0f;
+                deadZone = 0.3f + 0.15f * artifact;
+                break;
+            case 1: // AAC-ish: wider band, noise substitution in starved bands.
+                cutoffHz = juce::jmap(bitrate, 8.0f, 320.0f, 7000.0f, 20000.0f);
+                budgetScale = 1.2f;
+                deadZone = 0.15f;
+                noiseFill = true;
+                break;
+            case 2: // Opus-ish: band energies always kept, starved bands folded from below.
+                cutoffHz = bitrate < 24.0f ? 8000.0f : juce::jmap(bitrate, 24.0f, 320.0f, 12000.0f, 20000.0f);
+                budgetScale = 1.3f;
+                deadZone = 0.0f;
+                keepEnergy = true;
+                break;
+            case 3: // GSM-ish: telephone band at a fixed low rate.
+            default:
+                break;
+        }
+
+        const auto cutoffBin = juce::jmin(sagMdctSize, static_cast<int>(cutoffHz * binsPerHz));
+        const auto budget = bitrate * 1000.0f * budgetScale * juce::jmap(artifact, 1.0f, 0.45f)
+                          * static_cast<float>(sagMdctSize) / (static_cast<float>(currentSampleRate) * static_cast<float>(juce::jmax(1, channels)));
+
+        std::array<float, sagMaxBands> bandRms {};
+        std::array<float, sagMaxBands> bandDb {};
+        std::array<float, sagMaxBands> smr {};
+        std::array<int, sagMaxBands> bandBits {};
+
+        for (int b = 0; b < sagNumBands; ++b)
+        {
+            const auto lo = sagBandEdges[(size_t) b];
+            const auto hi = sagBandEdges[(size_t) b + 1];
+            auto energy = 0.0f;
+            for (int k = lo; k < hi; ++k)
+                energy += coeffs[k] * coeffs[k];
+
+            energy /= static_cast<float>(hi - lo);
+            bandRms[(size_t) b] = std::sqrt(energy);
+            bandDb[(size_t) b] = lo < cutoffBin ? 10.0f * std::log10(energy + 1.0e-20f) : -200.0f;
+        }
+
+        for (int b = 0; b < sagNumBands; ++b)
+        {
+            // Maskers spread upwards at 12 dB per band and downwards at 25 dB per band.
+            auto threshold = absoluteFloorDb;
+            for (int j = 0; j < sagNumBands; ++j)
+            {
+                const auto distance = static_cast<float>(b - j);
+                const auto spread = distance >= 0.0f ? bandDb[(size_t) j] - 12.0f * distance : bandDb[(size_t) j] + 25.0f * distance;
+                threshold = juce::jmax(threshold, spread - maskingOffsetDb);
+            }
+
+            smr[(size_t) b] = bandDb[(size_t) b] - threshold;
+        }
+
+        // Each bit goes to the band whose quantisation noise sits furthest above its mask, until
+        // the budget runs out or every band is masked.
+        for (auto remaining = budget;;)
+        {
+            auto best = -1;
+            auto bestNoiseToMask = 0.0f;
+            for (int b = 0; b < sagNumBands; ++b)
+            {
+                const auto width = sagBandEdges[(size_t) b + 1] - sagBandEdges[(size_t) b];
+                const auto noiseToMask = smr[(size_t) b] - 6.02f * static_cast<float>(bandBits[(size_t) b]);
+                if (bandBits[(size_t) b] < 15 && static_cast<float>(width) <= remaining && noiseToMask > bestNoiseToMask)
+                {
+                    best = b;
+                    bestNoiseToMask = noiseToMask;
+                }
+            }
+
+            if (best < 0)
+                break;
+
+            ++bandBits[(size_t) best];
+            remaining -= static_cast<float>(sagBandEdges[(size_t) best + 1] - sagBandEdges[(size_t) best]);
+        }
+
+        for (int b = 0; b < sagNumBands; ++b)
+        {
+            const auto lo = sagBandEdges[(size_t) b];
+            const auto hi = sagBandEdges[(size_t) b + 1];
+            const auto bits = bandBits[(size_t) b];
+            const auto width = hi - lo;
+
+            if (lo >= cutoffBin || bandDb[(size_t) b] < absoluteFloorDb)
+            {
+                std::fill(coeffs + lo, coeffs + hi, 0.0f);
+                continue;
+            }
+
+            // Scale factors travel with 1.5 dB resolution.
+            const auto codedRms = std::pow(10.0f, std::round(bandDb[(size_t) b] / 1.5f) * 1.5f / 20.0f);
+
+            if (bits > 0)
+            {
+                auto peak = 0.0f;
+                for (int k = lo; k < hi; ++k)
+                    peak = juce::jmax(peak, std::abs(coeffs[k]));
+
+                const auto step = peak / static_cast<float>((1 << bits) - 1);
+                auto decodedEnergy = 0.0f;
+                for (int k = lo; k < hi; ++k)
+                {
+                    const auto level = std::floor(juce::jmax(0.0f, std::abs(coeffs[k]) / step + 0.5f - deadZone));
+                    coeffs[k] = std::copysign(level * step, coeffs[k]);
+                    decodedEnergy += coeffs[k] * coeffs[k];
+                }
+
+                if (keepEnergy && decodedEnergy > 0.0f)
+                    juce::FloatVectorOperations::multiply(coeffs + lo, codedRms / std::sqrt(decodedEnergy / static_cast<float>(width)), width);
+            }
+            else if (noiseFill)
+            {
+                const auto fill = codedRms * juce::jmap(masking, 0.25f, 0.7f) * std::sqrt(3.0f);
+                for (int k = lo; k < hi; ++k)
+                    coeffs[k] = (rng.nextFloat() * 2.0f - 1.0f) * fill;
+            }
+            else if (keepEnergy && lo >= width)
+            {
+                auto foldedEnergy = 0.0f;
+                for (int k = lo; k < hi; ++k)
+                {
+                    coeffs[k] = rng.nextBool() ? coeffs[k - width] : -coeffs[k - width];
+                    foldedEnergy += coeffs[k] * coeffs[k];
+                }
+
+                const auto gain = foldedEnergy > 0.0f ? codedRms / std::sqrt(foldedEnergy / static_cast<float>(width)) : 0.0f;
+                juce::FloatVectorOperations::multiply(coeffs + lo, gain, width);
+            }
+            else
+            {
+                std::fill(coeffs + lo, coeffs + hi, 0.0f);
+            }
+        }
+    };
+
+    // Lost packets repeat the last good spectrum with scrambled signs and a decaying gain, the
+    // way decoders conceal them; the overlap-add turns that into the familiar warble.
+    auto concealFrame = [&](size_t c, float* coeffs, int lostFramesBefore)
+    {
+        auto& rng = channelRandom[c];
+        const auto fade = std::pow(0.7f, static_cast<float>(lostFramesBefore + 1));
+        const auto* last = sagLastCoeffs[c].data();
+        for (int k = 0; k < sagMdctSize; ++k)
+            coeffs[k] = (rng.nextBool() ? last[k] : -last[k]) * fade + (rng.nextFloat() * 2.0f - 1.0f) * concealNoise;
+    };
 
-    for (int ch = 0; ch < channels; ++ch)
+    // Which codec runs and whether the packet is lost are decided once per frame for all channels,
+    // ahead of the channels themselves so they can be processed independently of each other.
+    struct FrameDecision
     {
-        const auto c = static_cast<size_t>(ch);
-        auto* write = buffer.getWritePointer(ch);
-        auto prevAmp = aqHeldAmp[c];
+        int codec = 0;
+        bool lost = false;
+        int lostFramesBefore = 0;
+    };
 
-        for (int i = 0; i < samples; ++i)
+    auto decideFrame = [&]
+    {
+        FrameDecision decision;
+        if (codecEnabled)
         {
-            auto stepped = false;
-            if (--aqHeldCounter[c] <= 0)
+            if (codecMode == 0)
             {
-                const auto phaseStep = juce::MathConstants<float>::twoPi * lfoRate / static_cast<float>(currentSampleRate);
-                aqLfoPhase[c] += phaseStep;
-                if (aqLfoPhase[c] > juce::MathConstants<float>::twoPi)
-                    aqLfoPhase[c] -= juce::MathConstants<float>::twoPi;
-
-                if (phaseLock > 0.0f)
-                {
-                    const auto lockStep = juce::MathConstants<float>::twoPi / static_cast<float>(juce::jmax(1, stepDiv));
-                    const auto snapped = std::round(aqLfoPhase[c] / lockStep) * lockStep;
-                    aqLfoPhase[c] = juce::jmap(phaseLock, aqLfoPhase[c], snapped);
-                }
-
-                auto amp = 0.5f + 0.5f * std::sin(aqLfoPhase[c]);
-                amp = std::round(amp * static_cast<float>(quantLevels - 1)) / static_cast<float>(quantLevels - 1);
-
-                if (jitter > 0.0f)
-                    amp = juce::jlimit(0.0f, 1.0f, amp + (random.nextFloat() * 2.0f - 1.0f) * jitter * 0.06f);
-
-                prevAmp = aqHeldAmp[c];
-                aqHeldAmp[c] = amp;
-                stepped = true;
-                auto jitterHold = holdSamples;
-                if (jitter > 0.0f)
-                {
-                    const auto jitterOffset = static_cast<int>(std::round((random.nextFloat() * 2.0f - 1.0f) * jitter * 0.35f * holdSamples));
-                    jitterHold = juce::jmax(1, holdSamples + jitterOffset);
-                }
-                aqHeldCounter[c] = jitterHold;
+                sagCodec = 0;
+                sagCodecCounter = switchSamples;
             }
-
-            const auto modulationDepth = juce::jmap(brutal, 0.2f, 1.0f);
-            const auto modulation = juce::jmap(modulationDepth, 1.0f, aqHeldAmp[c]);
-            auto y = write[i] * modulation;
-
-            if (stepped)
+            else if ((sagCodecCounter -= sagMdctSize) <= 0)
             {
-                const auto zipperDelta = aqHeldAmp[c] - prevAmp;
-                y += zipperDelta * zipper * juce::jmap(brutal, 0.3f, 0.9f) * std::copysign(1.0f, y == 0.0f ? 1.0f : y);
+                if (codecMode == 1)
+                    sagCodec = (sagCodec + 1) % 4;
+                else
+                    sagCodec = random.nextInt(4);
+                sagCodecCounter = switchSamples;
             }
 
-            write[i] = std::tanh(y * juce::jmap(brutal, 1.2f, 3.2f));
+            if (sagLossBurstRemaining > 0)
+            {
+                decision.lost = true;
+                --sagLossBurstRemaining;
+            }
+            else if (random.nextFloat() < packetLoss)
+            {
+                decision.lost = true;
+                if (random.nextFloat() < burst)
+                    sagLossBurstRemaining = 1 + random.nextInt(juce::jmax(2, static_cast<int>(2 + burst * 12.0f)));
+            }
         }
-    }
-}
-
-void DigitalisAudioProcessor::processStreamingArtifactGenerator(juce::AudioBuffer<float>& buffer)
-{
-    const auto artifact = parameters.getRawParameterValue("artifact")->load() * 0.01f;
-    const auto bitrate = parameters.getRawParameterValue("bitrate")->load();
-    const auto masking = parameters.getRawParameterValue("masking")->load() * 0.01f;
-    const auto smear = parameters.getRawParameterValue("smear")->load() * 0.01f;
-    const auto codecMode = static_cast<int>(parameters.getRawParameterValue("codecMode")->load());
-    const auto switchMs = parameters.getRawParameterValue("switchMs")->load();
-    const auto packetLoss = parameters.getRawParameterValue("packetLoss")->load() * 0.01f;
-    const auto burst = parameters.getRawParameterValue("burst")->load() * 0.01f;
-    const auto preEcho = parameters.getRawParameterValue("preecho")->load() * 0.01f;
 
-    const auto channels = getTotalNumInputChannels();
-    const auto numSamples = buffer.getNumSamples();
-    const auto frameSize = juce::jlimit(16, 1024, static_cast<int>(std::round(64.0f + artifact * 384.0f)));
-    const auto switchSamples = juce::jmax(1, static_cast<int>(std::round((switchMs * 0.001f) * static_cast<float>(currentSampleRate))));
+        decision.codec = sagCodec;
+        decision.lostFramesBefore = sagLostFrames;
+        sagLostFrames = decision.lost ? sagLostFrames + 1 : 0;
+        return decision;
+    };
 
-    if (codecMode == 0)
-    {
-        sagCodec = 0;
-        sagCodecCounter = switchSamples;
-    }
-    else if (--sagCodecCounter <= 0)
+    auto runFrame = [&](size_t c, const FrameDecision& decision)
     {
-        if (codecMode == 1)
-            sagCodec = (sagCodec + 1) % 4;
-        else
-            sagCodec = random.nextInt(4);
-        sagCodecCounter = switchSamples;
-    }
+        auto& scratch = sagScratch[c];
+        auto* input = sagFrameInput[c].data();
+        auto* output = sagFrameOutput[c].data();
 
-    const auto bitrateCrush = juce::jlimit(8.0f, 4096.0f, std::pow(2.0f, juce::jmap(bitrate, 8.0f, 320.0f, 3.0f, 12.0f)));
-    const auto concealNoise = juce::jmap(masking, 0.0f, 1.0f, 0.0f, 0.04f);
+        if (codecEnabled)
+        {
+            juce::FloatVectorOperations::multiply(scratch.time.data(), input, sharedTables->mdctWindow.data(), 2 * sagMdctSize);
+            sagForwardMdct(scratch, scratch.time.data(), scratch.coeffs.data());
 
-    for (int start = 0; start < numSamples; start += frameSize)
-    {
-        const auto chunkSize = juce::jmin(frameSize, numSamples - start);
-        auto lost = false;
+            if (decision.lost)
+            {
+                concealFrame(c, scratch.coeffs.data(), decision.lostFramesBefore);
+            }
+            else
+            {
+                encodeFrame(scratch.coeffs.data(), decision.codec, channelRandom[c]);
+                juce::FloatVectorOperations::copy(sagLastCoeffs[c].data(), scratch.coeffs.data(), sagMdctSize);
+            }
 
-        if (sagLossBurstRemaining > 0)
-        {
-            lost = true;
-            --sagLossBurstRemaining;
+            sagInverseMdct(scratch, scratch.coeffs.data(), scratch.time.data());
+            juce::FloatVectorOperations::multiply(scratch.time.data(), sharedTables->mdctWindow.data(), 2 * sagMdctSize);
+            juce::FloatVectorOperations::add(output, sagOverlap[c].data(), scratch.time.data(), sagMdctSize);
+            juce::FloatVectorOperations::copy(sagOverlap[c].data(), scratch.time.data() + sagMdctSize, sagMdctSize);
         }
-        else if (random.nextFloat() < packetLoss)
+        else
         {
-            lost = true;
-            if (random.nextFloat() < burst)
-                sagLossBurstRemaining = 1 + random.nextInt(juce::jmax(2, static_cast<int>(2 + burst * 12.0f)));
+            // Bypassed inside the chain: keep the latency so the dry path stays aligned.
+            juce::FloatVectorOperations::copy(output, input, sagMdctSize);
+            juce::FloatVectorOperations::clear(sagOverlap[c].data(), sagMdctSize);
         }
 
-        for (int ch = 0; ch < channels; ++ch)
+        juce::FloatVectorOperations::copy(input, input + sagMdctSize, sagMdctSize);
+    };
+
+    // Frames run on their own timeline: input is collected one hop at a time and the decoded hop
+    // plays back two hops later, so the codec is unaffected by the host block size. The block is
+    // taken a few frames at a time: the frame decisions for a stretch are drawn first, then each
+    // channel runs through the stretch on its own.
+    constexpr int maxFramesPerStretch = 8;
+    auto* const* channelData = buffer.getArrayOfWritePointers();
+
+    for (int stretchStart = 0; stretchStart < numSamples;)
+    {
+        const auto stretchLength = juce::jmin(numSamples - stretchStart, sagFrameRemaining + (maxFramesPerStretch - 1) * sagMdctSize);
+        const auto numFrames = stretchLength < sagFrameRemaining ? 0 : 1 + (stretchLength - sagFrameRemaining) / sagMdctSize;
+        const auto frameRemainingAtStart = sagFrameRemaining;
+
+        std::array<FrameDecision, maxFramesPerStretch> decisions {};
+        for (int f = 0; f < numFrames; ++f)
+            decisions[(size_t) f] = decideFrame();
+
+        forEachChannel(channels, [&](int ch)
         {
             const auto c = static_cast<size_t>(ch);
-            auto* write = buffer.getWritePointer(ch, start);
+            auto& rng = channelRandom[c];
+            auto frameRemaining = frameRemainingAtStart;
+            auto frame = 0;
 
-            for (int i = 0; i < chunkSize; ++i)
+            for (int start = stretchStart; start < stretchStart + stretchLength;)
             {
-                auto x = write[i];
+                const auto chunkSize = juce::jmin(frameRemaining, stretchStart + stretchLength - start);
+                const auto hopPos = sagMdctSize - frameRemaining;
+                auto* write = channelData[ch] + start;
 
-                if (lost)
-                {
-                    if (random.nextFloat() < 0.5f)
-                        x = sagLastFrameSample[c];
-                    else
-                        x = (random.nextFloat() * 2.0f - 1.0f) * concealNoise;
-                }
+                juce::FloatVectorOperations::copy(sagFrameInput[c].data() + sagMdctSize + hopPos, write, chunkSize);
 
-                const auto mag = std::abs(x);
-                sagTransientEnv[c] = mag > sagTransientEnv[c] ? (0.6f * mag + 0.4f * sagTransientEnv[c])
-                                                              : (0.995f * sagTransientEnv[c] + 0.005f * mag);
+                // The decoded hop joins the pre-echo lookahead, sagPreEchoTaps samples behind the
+                // ones still waiting there from the previous chunk.
+                auto* pending = sagPreEchoOut[c].data();
+                auto* sources = sagPreEchoSource[c].data();
+                auto* incoming = pending + sagPreEchoTaps;
+                auto* incomingSources = sources + sagPreEchoTaps;
+                juce::FloatVectorOperations::copy(incoming, sagFrameOutput[c].data() + hopPos, chunkSize);
 
-                // Coarse stand-in for codec flavors.
-                switch (sagCodec)
+                if (codecEnabled)
                 {
-                    case 0: // MP3-ish: stronger masking + low-passed texture.
-                        x = quantise(x, bitrateCrush * juce::jmap(masking, 1.0f, 0.12f));
-                        sagToneState[c] += (x - sagToneState[c]) * juce::jmap(masking, 0.08f, 0.02f);
-                        x = sagToneState[c];
-                        break;
-                    case 1: // AAC-ish: cleaner highs but smearing.
-                        x = quantise(x, bitrateCrush * juce::jmap(masking, 1.0f, 0.35f));
-                        sagSmearState[c] = juce::jmap(0.35f + smear * 0.5f, x, sagSmearState[c]);
-                        x = juce::jmap(0.35f, x, sagSmearState[c]);
-                        break;
-                    case 2: // Opus-ish: smoother core with level-dependent wobble.
-                        x = quantise(x, bitrateCrush * 0.75f);
-                        x += (random.nextFloat() * 2.0f - 1.0f) * (0.008f + 0.018f * masking) * (0.4f + 0.6f * sagTransientEnv[c]);
-                        break;
-                    case 3: // GSM-ish: narrow + coarse.
-                    default:
-                        sagToneState[c] += (x - sagToneState[c]) * 0.05f;
-                        x = quantise(sagToneState[c], juce::jmax(12.0f, bitrateCrush * 0.2f));
-                        break;
-                }
+                    for (int i = 0; i < chunkSize; ++i)
+                    {
+                        auto x = incoming[i];
 
-                // Smear across time (tonal blurring).
-                sagSmearState[c] += (x - sagSmearState[c]) * juce::jmap(smear, 0.45f, 0.03f);
-                x = juce::jmap(smear * 0.75f, x, sagSmearState[c]);
+                        const auto mag = std::abs(x);
+                        sagTransientEnv[c] = followEnvelope(sagTransientEnv[c], mag, 0.6f, 0.995f);
 
-                // Pre-echo style writeback into recent samples on transient bursts.
-                if (preEcho > 0.0f && i > 4 && sagTransientEnv[c] > 0.25f && random.nextFloat() < preEcho * 0.04f)
-                {
-                    const auto taps = juce::jmin(i, 8);
-                    for (int t = 1; t <= taps; ++t)
+                        // Smear across time (tonal blurring).
+                        sagSmearState[c] += (x - sagSmearState[c]) * juce::jmap(smear, 0.45f, 0.03f);
+                        x = juce::jmap(smear * 0.75f, x, sagSmearState[c]);
+
+                        // A transient burst that leaks into the samples just before it.
+                        const auto echo = preEcho > 0.0f && sagTransientEnv[c] > 0.25f && rng.nextFloat() < preEcho * 0.04f;
+                        incomingSources[i] = echo ? x * preEcho * 0.09f : 0.0f;
+                        incoming[i] = x * juce::jmap(artifact, 1.0f, 2.1f);
+                    }
+
+                    saturateBlock(incoming, chunkSize);
+
+                    // Rendered forward: every output sample gathers the leaks of the bursts up to
+                    // sagPreEchoTaps samples after it, which the lookahead has already seen.
+                    for (int i = 0; i < chunkSize; ++i)
                     {
-                        const auto leak = preEcho * 0.09f / static_cast<float>(t);
-                        write[i - t] = juce::jlimit(-1.0f, 1.0f, write[i - t] + (x * leak));
+                        auto y = pending[i];
+                        for (int t = 1; t <= sagPreEchoTaps; ++t)
+                            y += sources[i + t] * preEchoWeights[(size_t) t - 1];
+                        write[i] = juce::jlimit(-1.0f, 1.0f, y);
                     }
                 }
+                else
+                {
+                    std::fill(incomingSources, incomingSources + chunkSize, 0.0f);
+                    juce::FloatVectorOperations::copy(write, pending, chunkSize);
+                }
 
-                x = std::tanh(x * juce::jmap(artifact, 1.0f, 2.1f));
-                write[i] = x;
-                sagLastFrameSample[c] = x;
+                std::copy(pending + chunkSize, pending + chunkSize + sagPreEchoTaps, pending);
+                std::copy(sources + chunkSize, sources + chunkSize + sagPreEchoTaps, sources);
+
+                frameRemaining -= chunkSize;
+                start += chunkSize;
+
+                if (frameRemaining == 0)
+                {
+                    runFrame(c, decisions[(size_t) frame++]);
+                    frameRemaining = sagMdctSize;
+                }
             }
-        }
+        });
+
+        sagFrameRemaining = (frameRemainingAtStart - stretchLength) > 0 ? frameRemainingAtStart - stretchLength
+                                                                        : sagMdctSize - (stretchLength - frameRemainingAtStart) % sagMdctSize;
+        stretchStart += stretchLength;
+    }
+}
+
+// DCT-IV of sagMdctSize points through a quarter-length complex FFT with pre- and post-twiddles.
+void DigitalisAudioProcessor::sagDctIV(SagScratch& scratch, const float* input, float* output)
+{
+    constexpr auto n = sagMdctSize;
+    const auto& tables = *sharedTables;
+
+    for (int i = 0; i < n / 2; ++i)
+        scratch.fftIn[(size_t) i] = juce::dsp::Complex<float>(input[2 * i], input[n - 1 - 2 * i]) * tables.mdctPreTwiddle[(size_t) i];
+
+    scratch.fft->perform(scratch.fftIn.data(), scratch.fftOut.data(), false);
+
+    for (int i = 0; i < n / 2; ++i)
+    {
+        const auto w = scratch.fftOut[(size_t) i] * tables.mdctPostTwiddle[(size_t) i];
+        output[2 * i] = w.real();
+        output[n - 1 - 2 * i] = -w.imag();
+    }
+}
+
+void DigitalisAudioProcessor::sagForwardMdct(SagScratch& scratch, const float* input, float* coeffs)
+{
+    constexpr auto n = sagMdctSize;
+    constexpr auto half = n / 2;
+
+    // Fold the 2N windowed samples (a, b, c, d) into (-c_r - d, a - b_r).
+    for (int i = 0; i < half; ++i)
+    {
+        scratch.fold[(size_t) i] = -input[3 * half - 1 - i] - input[3 * half + i];
+        scratch.fold[(size_t) (half + i)] = input[i] - input[n - 1 - i];
+    }
+
+    sagDctIV(scratch, scratch.fold.data(), coeffs);
+}
+
+void DigitalisAudioProcessor::sagInverseMdct(SagScratch& scratch, const float* coeffs, float* output)
+{
+    constexpr auto n = sagMdctSize;
+    constexpr auto half = n / 2;
+    constexpr auto scale = 2.0f / static_cast<float>(n);
+
+    sagDctIV(scratch, coeffs, scratch.fold.data());
+
+    // Unfold (u1, u2) into (u2, -u2_r, -u1_r, -u1); windowed overlap-add cancels the aliasing.
+    for (int i = 0; i < half; ++i)
+    {
+        output[i] = scratch.fold[(size_t) (half + i)] * scale;
+        output[half + i] = -scratch.fold[(size_t) (n - 1 - i)] * scale;
+        output[n + i] = -scratch.fold[(size_t) (half - 1 - i)] * scale;
+        output[n + half + i] = -scratch.fold[(size_t) i] * scale;
     }
 }
 
@@ -1423,55 +3014,92 @@ void DigitalisAudioProcessor::processFFTBrutalist(juce::AudioBuffer<float>& buff
     const auto holdBase = juce::jmax(1, clusterSize * juce::jmax(1, static_cast<int>(1 + binDensity * 10.0f)));
     const auto phaseStep = juce::MathConstants<float>::twoPi / static_cast<float>(phaseSteps);
 
-    for (int ch = 0; ch < channels; ++ch)
-    {
-        auto* write = buffer.getWritePointer(ch);
-        auto held = 0.0f;
-        auto holdCounter = 0;
-        auto phase = 0.0f;
-        auto freezeValue = 0.0f;
-        auto freezeCounter = 0;
+    const auto linked = channels > 1 && parameters.getRawParameterValue("stereoLink")->load() >= 0.5f;
+    const auto lanes = linked ? channels : 1;
+    auto* const* channelData = buffer.getArrayOfWritePointers();
+
+    // Unlinked, each channel is a group of its own. Linked, the channels form one group whose
+    // freeze, hold and phase decisions are taken once per sample frame from the first channel's
+    // state; only the captured sample values are kept per channel.
+    forEachChannel(channels / lanes, [&](int group)
+    {
+        const auto first = group * lanes;
+        const auto c = static_cast<size_t>(first);
+        auto& rng = channelRandom[c];
+        auto holdCounter = fftBrutalistHoldCounter[c];
+        auto phase = fftBrutalistPhase[c];
+        auto freezeCounter = fftBrutalistFreezeRemaining[c];
+        std::array<float, 2> held {};
+        std::array<float, 2> freezeValue {};
+        for (int l = 0; l < lanes; ++l)
+        {
+            held[(size_t) l] = fftBrutalistHeld[(size_t) (first + l)];
+            freezeValue[(size_t) l] = fftBrutalistFreezeValue[(size_t) (first + l)];
+        }
 
         for (int i = 0; i < samples; ++i)
         {
-            auto x = write[i];
-
-            if (freezeCounter > 0)
+            const auto frozen = freezeCounter > 0;
+            auto startsFreeze = false;
+            if (frozen)
             {
-                x = freezeValue;
                 --freezeCounter;
             }
-            else if (random.nextFloat() < freezeRate * 0.02f)
+            else if (rng.nextFloat() < freezeRate * 0.02f)
             {
-                freezeValue = x;
-                freezeCounter = freezeSamples;
+                // Freezes were voiced against 512-sample host blocks and never outlived the block;
+                // keep that cap on a fixed grid instead of the host's block boundaries.
+                const auto toGridEdge = referenceBlockSize - ((processedSamples + i) % referenceBlockSize);
+                freezeCounter = juce::jmin(freezeSamples, toGridEdge);
+                startsFreeze = true;
             }
 
-            if (--holdCounter <= 0)
-            {
-                held = x;
-                holdCounter = juce::jmax(1, holdBase + random.nextInt(juce::jmax(2, holdBase)));
-            }
-            x = juce::jmap(binDensity, x, held);
+            const auto reloadsHold = --holdCounter <= 0;
+            if (reloadsHold)
+                holdCounter = juce::jmax(1, holdBase + rng.nextInt(juce::jmax(2, holdBase)));
 
             phase += juce::jmap(brutalism, 0.01f, 0.25f) + spectralJitter * 0.04f;
             if (phase > juce::MathConstants<float>::twoPi)
                 phase -= juce::MathConstants<float>::twoPi;
 
             const auto snappedPhase = std::round(phase / phaseStep) * phaseStep;
-            const auto randomPhase = (random.nextFloat() * juce::MathConstants<float>::twoPi) - juce::MathConstants<float>::pi;
+            const auto randomPhase = (rng.nextFloat() * juce::MathConstants<float>::twoPi) - juce::MathConstants<float>::pi;
             const auto warpedPhase = juce::jmap(phaseScramble, snappedPhase, randomPhase);
             const auto carrier = std::sin(warpedPhase);
-            x = juce::jmap(phaseScramble, x, x * carrier);
 
-            const auto mag = std::abs(x);
-            const auto sortedProxy = std::pow(mag, juce::jmap(sortAmount, 1.0f, 0.28f));
-            x = std::copysign(sortedProxy, x);
+            for (int l = 0; l < lanes; ++l)
+            {
+                const auto lane = (size_t) l;
+                auto* write = channelData[first + l];
+                auto x = frozen ? freezeValue[lane] : write[i];
+
+                if (startsFreeze)
+                    freezeValue[lane] = x;
+                if (reloadsHold)
+                    held[lane] = x;
+
+                x = juce::jmap(binDensity, x, held[lane]);
+                x = juce::jmap(phaseScramble, x, x * carrier);
+
+                const auto mag = std::abs(x);
+                const auto sortedProxy = std::pow(mag, juce::jmap(sortAmount, 1.0f, 0.28f));
+                x = std::copysign(sortedProxy, x);
+
+                x = saturate(x * juce::jmap(brutalism, 1.0f, 2.4f));
+                write[i] = juce::jlimit(-1.0f, 1.0f, x);
+            }
+        }
 
-            x = std::tanh(x * juce::jmap(brutalism, 1.0f, 2.4f));
-            write[i] = juce::jlimit(-1.0f, 1.0f, x);
+        for (int l = 0; l < lanes; ++l)
+        {
+            const auto lane = (size_t) (first + l);
+            fftBrutalistHeld[lane] = held[(size_t) l];
+            fftBrutalistFreezeValue[lane] = freezeValue[(size_t) l];
+            fftBrutalistHoldCounter[lane] = holdCounter;
+            fftBrutalistPhase[lane] = phase;
+            fftBrutalistFreezeRemaining[lane] = freezeCounter;
         }
-    }
+    });
 }
 
 void DigitalisAudioProcessor::processOverclockFailure(juce::AudioBuffer<float>& buffer)
@@ -1487,92 +3115,178 @@ void DigitalisAudioProcessor::processOverclockFailure(juce::AudioBuffer<float>&
     const auto channels = getTotalNumInputChannels();
     const auto numSamples = buffer.getNumSamples();
 
-    // Compute audio-reactive stress and thermal integration.
-    auto blockEnergy = 0.0f;
-    for (int ch = 0; ch < channels; ++ch)
-    {
-        const auto* read = buffer.getReadPointer(ch);
-        for (int i = 0; i < numSamples; ++i)
-            blockEnergy += std::abs(read[i]);
-    }
-    blockEnergy /= static_cast<float>(juce::jmax(1, channels * numSamples));
-
-    const auto stressTarget = juce::jlimit(0.0f, 1.0f, blockEnergy * (0.8f + 3.2f * sensitivity) + overclock * 0.35f);
-    ocfStressEnv += (stressTarget - ocfStressEnv) * juce::jmap(recovery, 0.25f, 0.01f);
-    const auto thermalRise = (overclock * 0.0012f + ocfStressEnv * 0.0018f) * (0.35f + thermal);
-    const auto thermalFall = 0.0003f + recovery * 0.0012f;
-    ocfThermalState = juce::jlimit(0.0f, 1.0f, ocfThermalState + thermalRise - thermalFall);
-
-    const auto failChance = juce::jlimit(0.0f, 0.85f, failureRate * (0.25f + 0.75f * ocfStressEnv) + ocfThermalState * 0.28f);
+    // Stress and thermal integration tick on the control grid; the per-block rates below were
+    // tuned at referenceBlockSize and are rescaled per tick.
+    const auto tickRatio = static_cast<float>(controlBlockSize) / static_cast<float>(referenceBlockSize);
+    const auto stressCoeff = 1.0f - std::pow(1.0f - juce::jmap(recovery, 0.25f, 0.01f), tickRatio);
+    const auto thermalFall = (0.0003f + recovery * 0.0012f) * tickRatio;
     const auto spikeMax = juce::jmax(1, static_cast<int>(2 + latencySpike * 180.0f + thermal * 80.0f));
     const auto baseDesync = static_cast<int>(desync * 120.0f);
 
-    for (int ch = 0; ch < channels; ++ch)
+    // Stress and thermal state read every channel, so they are stepped for a stretch of control
+    // segments first; the channels then run through the stretch independently.
+    struct ControlSegment
     {
-        const auto c = static_cast<size_t>(ch);
-        auto* write = buffer.getWritePointer(ch);
-        auto& delayLine = ocfDelayLine[c];
-        const auto delaySize = static_cast<int>(delayLine.size());
+        int start = 0;
+        int length = 0;
+        float failChance = 0.0f;
+        float thermalState = 0.0f;
+    };
 
-        // Desync right channel harder to emulate thread drift.
-        const auto channelDesync = (ch % 2 == 1) ? baseDesync : static_cast<int>(baseDesync * 0.35f);
+    constexpr int maxSegmentsPerStretch = 64;
+    std::array<ControlSegment, maxSegmentsPerStretch> segments {};
+    const auto linked = channels > 1 && parameters.getRawParameterValue("stereoLink")->load() >= 0.5f;
+    const auto lanes = linked ? channels : 1;
+    auto* const* channelData = buffer.getArrayOfWritePointers();
 
-        for (int i = 0; i < numSamples; ++i)
+    for (int stretchStart = 0; stretchStart < numSamples;)
+    {
+        auto numSegments = 0;
+        auto start = stretchStart;
+
+        for (; start < numSamples && numSegments < maxSegmentsPerStretch; ++numSegments)
         {
-            auto x = write[i];
+            const auto segment = juce::jmin(ocfControlCountdown, numSamples - start);
 
-            // Random processing skips and hold glitches under stress.
-            if (ocfHoldRemaining[c] > 0)
+            // Compute audio-reactive stress and thermal integration.
+            for (int ch = 0; ch < channels; ++ch)
             {
-                x = ocfHoldValue[c];
-                --ocfHoldRemaining[c];
+                const auto* read = channelData[ch] + start;
+                for (int i = 0; i < segment; ++i)
+                    ocfControlEnergy += std::abs(read[i]);
             }
-            else if (random.nextFloat() < failChance * 0.05f)
+
+            ocfControlCountdown -= segment;
+            if (ocfControlCountdown <= 0)
             {
-                ocfHoldValue[c] = x;
-                ocfHoldRemaining[c] = 1 + random.nextInt(juce::jmax(2, static_cast<int>(2 + failChance * 24.0f)));
-                x = ocfHoldValue[c];
+                const auto tickEnergy = ocfControlEnergy / static_cast<float>(juce::jmax(1, channels * controlBlockSize));
+                const auto stressTarget = juce::jlimit(0.0f, 1.0f, tickEnergy * (0.8f + 3.2f * sensitivity) + overclock * 0.35f);
+                ocfStressEnv += (stressTarget - ocfStressEnv) * stressCoeff;
+                const auto thermalRise = (overclock * 0.0012f + ocfStressEnv * 0.0018f) * (0.35f + thermal) * tickRatio;
+                ocfThermalState = juce::jlimit(0.0f, 1.0f, ocfThermalState + thermalRise - thermalFall);
+                ocfControlEnergy = 0.0f;
+                ocfControlCountdown = controlBlockSize;
             }
 
-            if (random.nextFloat() < failChance * 0.03f)
-                x = 0.0f; // dropped sample burst
+            segments[(size_t) numSegments] = { start, segment,
+                                                juce::jlimit(0.0f, 0.85f, failureRate * (0.25f + 0.75f * ocfStressEnv) + ocfThermalState * 0.28f),
+                                                ocfThermalState };
+            start += segment;
+        }
 
-            // Latency spikes: jump read offset unpredictably.
-            if (random.nextFloat() < latencySpike * (0.01f + failChance * 0.02f))
-            {
-                ocfDelayReadOffset[c] = 1 + random.nextInt(spikeMax + juce::jmax(1, channelDesync));
-            }
-            else
+        // Linked channels share the first channel's hold, drop and spike decisions. Each keeps its
+        // own held value and delay line, and the desync between them stays a fixed offset.
+        forEachChannel(channels / lanes, [&](int group)
+        {
+            const auto first = group * lanes;
+            const auto c = static_cast<size_t>(first);
+            auto& rng = channelRandom[c];
+            const auto delaySize = static_cast<int>(ocfDelayLine[c].size());
+
+            // Desync right channel harder to emulate thread drift.
+            const auto desyncFor = [&](int ch) { return (ch % 2 == 1) ? baseDesync : static_cast<int>(baseDesync * 0.35f); };
+            const auto channelDesync = desyncFor(first);
+            auto driftPhase = ocfDriftPhase[c];
+
+            for (int s = 0; s < numSegments; ++s)
             {
-                const auto nominal = 1 + channelDesync;
-                const auto pull = juce::jmax(1, nominal);
-                ocfDelayReadOffset[c] += (pull - ocfDelayReadOffset[c]) > 0 ? 1 : -1;
-                ocfDelayReadOffset[c] = juce::jlimit(1, spikeMax + juce::jmax(1, channelDesync), ocfDelayReadOffset[c]);
-            }
+                const auto& seg = segments[(size_t) s];
+                const auto failChance = seg.failChance;
 
-            const auto writePos = ocfDelayWritePos[c];
-            delayLine[(size_t) writePos] = x;
-            auto readPos = writePos - ocfDelayReadOffset[c];
-            while (readPos < 0)
-                readPos += delaySize;
-            auto y = delayLine[(size_t) (readPos % delaySize)];
+                // Thermal drift detunes timing/amplitude subtly over long sessions.
+                const auto driftRate = 0.00007f + seg.thermalState * 0.00025f;
+                const auto driftDepth = 0.01f + seg.thermalState * 0.06f;
 
-            ocfDelayWritePos[c] = (writePos + 1) % delaySize;
+                for (int i = 0; i < seg.length; ++i)
+                {
+                    // Random processing skips and hold glitches under stress.
+                    const auto holding = ocfHoldRemaining[c] > 0;
+                    auto startsHold = false;
+                    if (holding)
+                    {
+                        --ocfHoldRemaining[c];
+                    }
+                    else if (rng.nextFloat() < failChance * 0.05f)
+                    {
+                        ocfHoldRemaining[c] = 1 + rng.nextInt(juce::jmax(2, static_cast<int>(2 + failChance * 24.0f)));
+                        startsHold = true;
+                    }
 
-            // Thermal drift detunes timing/amplitude subtly over long sessions.
-            const auto drift = 1.0f + std::sin((processedSamples + i + ch * 31) * (0.00007f + ocfThermalState * 0.00025f)) * (0.01f + ocfThermalState * 0.06f);
-            y *= drift;
-            y = std::tanh(y * juce::jmap(overclock, 1.0f, 1.9f));
+                    const auto dropped = rng.nextFloat() < failChance * 0.03f; // dropped sample burst
 
-            write[i] = juce::jlimit(-1.0f, 1.0f, y);
-        }
+                    // Latency spikes: jump read offset unpredictably.
+                    if (rng.nextFloat() < latencySpike * (0.01f + failChance * 0.02f))
+                    {
+                        ocfDelayReadOffset[c] = 1 + rng.nextInt(spikeMax + juce::jmax(1, channelDesync));
+                    }
+                    else
+                    {
+                        const auto nominal = 1 + channelDesync;
+                        const auto pull = juce::jmax(1, nominal);
+                        ocfDelayReadOffset[c] += (pull - ocfDelayReadOffset[c]) > 0 ? 1 : -1;
+                        ocfDelayReadOffset[c] = juce::jlimit(1, spikeMax + juce::jmax(1, channelDesync), ocfDelayReadOffset[c]);
+                    }
+
+                    const auto writePos = ocfDelayWritePos[c];
+                    const auto drive = juce::jmap(overclock, 1.0f, 1.9f);
+                    const auto drift = 1.0f + std::sin(driftPhase) * driftDepth;
+
+                    driftPhase += driftRate;
+                    if (driftPhase > juce::MathConstants<float>::twoPi)
+                        driftPhase -= juce::MathConstants<float>::twoPi;
+
+                    for (int l = 0; l < lanes; ++l)
+                    {
+                        const auto ch = first + l;
+                        const auto lane = static_cast<size_t>(ch);
+                        auto* write = channelData[ch] + seg.start;
+                        auto& delayLine = ocfDelayLine[lane];
+                        auto x = write[i];
+
+                        if (holding)
+                            x = ocfHoldValue[lane];
+                        else if (startsHold)
+                            ocfHoldValue[lane] = x;
+
+                        if (dropped)
+                            x = 0.0f;
+
+                        delayLine[(size_t) writePos] = x;
+                        auto readPos = writePos - ocfDelayReadOffset[c] - (desyncFor(ch) - channelDesync);
+                        while (readPos < 0)
+                            readPos += delaySize;
+                        auto y = delayLine[(size_t) (readPos % delaySize)];
+
+                        y *= drift;
+                        y = saturate(y * drive);
+
+                        write[i] = juce::jlimit(-1.0f, 1.0f, y);
+                    }
+
+                    ocfDelayWritePos[c] = (writePos + 1) % delaySize;
+                }
+            }
+
+            ocfDriftPhase[c] = driftPhase;
+
+            for (int l = 1; l < lanes; ++l)
+            {
+                const auto lane = static_cast<size_t>(first + l);
+                ocfDriftPhase[lane] = ocfDriftPhase[c];
+                ocfHoldRemaining[lane] = ocfHoldRemaining[c];
+                ocfDelayReadOffset[lane] = ocfDelayReadOffset[c] + desyncFor(first + l) - channelDesync;
+                ocfDelayWritePos[lane] = ocfDelayWritePos[c];
+            }
+        });
+
+        stretchStart = start;
     }
 }
 
 void DigitalisAudioProcessor::processDeterministicMachine(juce::AudioBuffer<float>& buffer)
 {
     const auto determinism = parameters.getRawParameterValue("determinism")->load() * 0.01f;
-    const auto stateCount = juce::jmax(2, static_cast<int>(std::round(parameters.getRawParameterValue("stateCount")->load())));
+    const auto stateCount = juce::jlimit(2, dmMaxStates, static_cast<int>(std::round(parameters.getRawParameterValue("stateCount")->load())));
     const auto stateDwellMs = parameters.getRawParameterValue("stateDwell")->load();
     const auto loopMs = parameters.getRawParameterValue("loopMs")->load();
     const auto hashWindow = juce::jmax(8, static_cast<int>(std::round(parameters.getRawParameterValue("hashWindow")->load())));
@@ -1585,73 +3299,159 @@ void DigitalisAudioProcessor::processDeterministicMachine(juce::AudioBuffer<floa
                                          static_cast<int>(std::round(loopMs * 0.001 * currentSampleRate)));
     const auto dwellSamples = juce::jmax(1, static_cast<int>(std::round(stateDwellMs * 0.001 * currentSampleRate)));
 
-    for (auto& loop : dmLoopBuffer)
+    // The loop buffers are allocated for the longest loop up front; a length change clears the part
+    // now in use and wraps the positions into it.
+    if (loopLength != dmLoopLength)
     {
-        if ((int) loop.size() != loopLength)
-            loop.assign((size_t) loopLength, 0.0f);
+        for (size_t c = 0; c < dmLoopBuffer.size(); ++c)
+        {
+            std::fill_n(dmLoopBuffer[c].begin(), loopLength, 0.0f);
+            dmLoopWritePos[c] %= loopLength;
+            dmLoopReadPos[c] %= loopLength;
+        }
+        dmLoopLength = loopLength;
     }
 
-    for (int i = 0; i < samples; ++i)
+    // Everything an output sample needs from its state is looked up, not recomputed per sample.
+    if (stateCount != dmTableStateCount || ! juce::exactlyEqual(determinism, dmTableDeterminism))
     {
-        auto probe = 0.0f;
-        for (int ch = 0; ch < channels; ++ch)
-            probe += buffer.getSample(ch, i);
-        probe /= static_cast<float>(juce::jmax(1, channels));
+        for (int state = 0; state < stateCount; ++state)
+        {
+            const auto stateNorm = static_cast<float>(state) / static_cast<float>(juce::jmax(1, stateCount - 1));
+            dmStateTable[(size_t) state] = {
+                juce::jmap(stateNorm, 0.45f, 1.65f),
+                juce::jmax(8.0f, 1024.0f - (determinism * 700.0f + stateNorm * 240.0f)),
+                juce::jlimit(0.0f, 1.0f, determinism * (0.25f + 0.75f * (stateNorm > 0.45f ? 1.0f : 0.0f))),
+                juce::jmap(stateNorm, 0.8f, 2.5f) * juce::MathConstants<float>::pi,
+                // State quantisation gate: only a finite set of outputs per state.
+                static_cast<float>(juce::jmax(2, 2 + (state % 24)))
+            };
+        }
 
-        dmHashState = hashStep(dmHashState, probe);
-        ++dmHashCounter;
+        dmTableStateCount = stateCount;
+        dmTableDeterminism = determinism;
+        dmCurveState = -1;
+    }
 
-        if (--dmSamplesToNextState <= 0 || dmHashCounter >= hashWindow)
-        {
-            const auto hashBased = static_cast<int>(dmHashState % static_cast<std::uint32_t>(stateCount));
-            auto nextState = dmStateIndex;
+    const auto outputDrive = juce::jmap(determinism, 1.0f, 2.2f);
+    constexpr int maxRun = 64;
+    std::array<float, maxRun> probes {};
+    std::array<float, maxRun> gains {};
 
-            if (jumpRule == 0)
-                nextState = (dmStateIndex + 1) % stateCount;
-            else if (jumpRule == 1)
-                nextState = hashBased;
-            else
-                nextState = std::abs(probe) > (0.15f + determinism * 0.35f) ? hashBased : dmStateIndex;
+    const auto renderRun = [&](int start, int count)
+    {
+        const auto& state = dmStateTable[(size_t) dmStateIndex];
+        const auto shape = [&](float level)
+        {
+            const auto y = quantise(std::sin(level / state.crushSteps * state.fold), state.levels);
+            return juce::jlimit(-1.0f, 1.0f, saturate(y * outputDrive));
+        };
 
-            if (random.nextFloat() < memory)
-                nextState = static_cast<int>(std::round(juce::jmap(memory, static_cast<float>(nextState), static_cast<float>(dmStateIndex))));
+        if (dmCurveState != dmStateIndex || dmCurveTier != qualityTier)
+        {
+            if (dmCurveLo <= dmCurveHi)
+                std::fill(dmCurve.begin() + dmCurveLo, dmCurve.begin() + dmCurveHi + 1, std::numeric_limits<float>::quiet_NaN());
 
-            dmStateIndex = juce::jlimit(0, stateCount - 1, nextState);
-            dmSamplesToNextState = dwellSamples;
-            dmHashCounter = 0;
-            dmHashState ^= (static_cast<std::uint32_t>(dmStateIndex) * 2654435761u);
+            dmCurveLo = static_cast<int>(dmCurve.size());
+            dmCurveHi = -1;
+            dmCurveState = dmStateIndex;
+            dmCurveTier = qualityTier;
         }
 
-        const auto stateNorm = static_cast<float>(dmStateIndex) / static_cast<float>(juce::jmax(1, stateCount - 1));
-        const auto gainTarget = juce::jmap(stateNorm, 0.45f, 1.65f);
-        dmStateSmoother += (gainTarget - dmStateSmoother) * 0.015f;
-        const auto crushSteps = juce::jmax(8.0f, 1024.0f - (determinism * 700.0f + stateNorm * 240.0f));
-        const auto loopBlend = juce::jlimit(0.0f, 1.0f, determinism * (0.25f + 0.75f * (stateNorm > 0.45f ? 1.0f : 0.0f)));
-        const auto fold = juce::jmap(stateNorm, 0.8f, 2.5f);
+        for (int k = 0; k < count; ++k)
+        {
+            dmStateSmoother += (state.gainTarget - dmStateSmoother) * 0.015f;
+            gains[(size_t) k] = dmStateSmoother;
+        }
 
         for (int ch = 0; ch < channels; ++ch)
         {
             const auto c = static_cast<size_t>(ch);
-            auto* write = buffer.getWritePointer(ch);
+            auto* write = buffer.getWritePointer(ch, start);
             auto& loop = dmLoopBuffer[c];
-            const auto in = write[i];
 
-            loop[(size_t) dmLoopWritePos[c]] = in;
-            dmLoopWritePos[c] = (dmLoopWritePos[c] + 1) % loopLength;
+            for (int k = 0; k < count; ++k)
+            {
+                const auto in = write[k];
+
+                loop[(size_t) dmLoopWritePos[c]] = in;
+                dmLoopWritePos[c] = (dmLoopWritePos[c] + 1) % loopLength;
+
+                const auto loopSample = loop[(size_t) dmLoopReadPos[c]];
+                dmLoopReadPos[c] = (dmLoopReadPos[c] + 1) % loopLength;
+
+                const auto level = std::round(juce::jmap(state.loopBlend, in, loopSample) * gains[(size_t) k] * state.crushSteps);
+
+                if (std::abs(level) <= static_cast<float>(dmCurveReach))
+                {
+                    const auto index = static_cast<int>(level) + dmCurveReach;
+                    auto& entry = dmCurve[(size_t) index];
+                    if (std::isnan(entry))
+                    {
+                        entry = shape(level);
+                        dmCurveLo = juce::jmin(dmCurveLo, index);
+                        dmCurveHi = juce::jmax(dmCurveHi, index);
+                    }
+
+                    write[k] = entry;
+                }
+                else
+                {
+                    write[k] = shape(level);
+                }
+            }
+        }
+    };
 
-            const auto loopSample = loop[(size_t) dmLoopReadPos[c]];
-            dmLoopReadPos[c] = (dmLoopReadPos[c] + 1) % loopLength;
+    // The host block is cut at state transitions (and every maxRun samples), which never depend on
+    // the hash. Each run is hashed as a block; if it ends a window, the next state is chosen before
+    // its last sample is rendered.
+    for (int i = 0; i < samples;)
+    {
+        const auto untilTransition = juce::jmax(1, juce::jmin(dmSamplesToNextState, hashWindow - dmHashCounter));
+        const auto run = juce::jmin(untilTransition, maxRun, samples - i);
 
-            auto y = juce::jmap(loopBlend, in, loopSample);
-            y = quantise(y * dmStateSmoother, crushSteps);
-            y = std::sin(y * juce::MathConstants<float>::pi * fold);
+        juce::FloatVectorOperations::copy(probes.data(), buffer.getReadPointer(0, i), run);
+        for (int ch = 1; ch < channels; ++ch)
+            juce::FloatVectorOperations::add(probes.data(), buffer.getReadPointer(ch, i), run);
+        if (channels > 1)
+            juce::FloatVectorOperations::multiply(probes.data(), 1.0f / static_cast<float>(channels), run);
 
-            // State quantisation gate: only a finite set of outputs per state.
-            const auto stateLevels = juce::jmax(2, 2 + (dmStateIndex % 24));
-            y = quantise(y, static_cast<float>(stateLevels));
+        hashSamples(dmHashLanes, dmHashCounter, probes.data(), run);
+        dmHashCounter += run;
+        dmSamplesToNextState -= run;
 
-            write[i] = juce::jlimit(-1.0f, 1.0f, std::tanh(y * juce::jmap(determinism, 1.0f, 2.2f)));
+        if (dmSamplesToNextState > 0 && dmHashCounter < hashWindow)
+        {
+            renderRun(i, run);
+            i += run;
+            continue;
         }
+
+        renderRun(i, run - 1);
+
+        const auto windowHash = foldHashLanes(dmHashLanes);
+        const auto hashBased = static_cast<int>(windowHash % static_cast<std::uint32_t>(stateCount));
+        const auto probe = probes[(size_t) run - 1];
+        auto nextState = dmStateIndex;
+
+        if (jumpRule == 0)
+            nextState = (dmStateIndex + 1) % stateCount;
+        else if (jumpRule == 1)
+            nextState = hashBased;
+        else
+            nextState = std::abs(probe) > (0.15f + determinism * 0.35f) ? hashBased : dmStateIndex;
+
+        if (random.nextFloat() < memory)
+            nextState = static_cast<int>(std::round(juce::jmap(memory, static_cast<float>(nextState), static_cast<float>(dmStateIndex))));
+
+        dmStateIndex = juce::jlimit(0, stateCount - 1, nextState);
+        dmSamplesToNextState = dwellSamples;
+        dmHashCounter = 0;
+        seedHashLanes(dmHashLanes, windowHash ^ (static_cast<std::uint32_t>(dmStateIndex) * 2654435761u));
+
+        renderRun(i + run - 1, 1);
+        i += run;
     }
 }
 
@@ -1674,46 +3474,73 @@ void DigitalisAudioProcessor::processClassicBufferStutter(juce::AudioBuffer<floa
     const auto triggerProb = juce::jmap(amount, 0.04f, 1.0f);
     const auto inputDuck = juce::jmap(duck, 1.0f, 0.22f);
 
-    for (int ch = 0; ch < channels; ++ch)
+    const auto linked = channels > 1 && parameters.getRawParameterValue("stereoLink")->load() >= 0.5f;
+    const auto lanes = linked ? channels : 1;
+    auto* const* channelData = buffer.getArrayOfWritePointers();
+
+    // Linked channels run one stutter state machine, the first channel's, and only keep their own
+    // slice buffers.
+    forEachChannel(channels / lanes, [&](int group)
     {
-        const auto c = static_cast<size_t>(ch);
-        auto* write = buffer.getWritePointer(ch);
-        auto& slice = stutterSliceBuffer[c];
+        const auto first = group * lanes;
+        const auto c = static_cast<size_t>(first);
+        auto& rng = channelRandom[c];
 
-        if ((int) slice.size() < maxSliceLength)
-            slice.assign((size_t) maxSliceLength, 0.0f);
+        for (int l = 0; l < lanes; ++l)
+            if (stutterSliceBuffer[(size_t) (first + l)].size() < maxSliceLength)
+                stutterSliceBuffer[(size_t) (first + l)].setSize(maxSliceLength);
 
         for (int i = 0; i < samples; ++i)
         {
-            const auto in = write[i];
-            auto out = in;
-
             if (!stutterIsCapturing[c] && !stutterIsPlaying[c])
             {
                 if (--stutterIntervalCounter[c] <= 0)
                 {
-                    if (random.nextFloat() < triggerProb)
+                    if (rng.nextFloat() < triggerProb)
                     {
                         stutterIsCapturing[c] = true;
                         stutterCapturePos[c] = 0;
-                        stutterIsReverse[c] = random.nextFloat() < reverseChance;
+                        stutterIsReverse[c] = rng.nextFloat() < reverseChance;
                     }
 
                     auto jitteredInterval = baseInterval;
                     if (timingJitter > 0.0f)
                     {
-                        const auto offset = static_cast<int>(std::round((random.nextFloat() * 2.0f - 1.0f) * timingJitter * 0.4f * static_cast<float>(baseInterval)));
+                        const auto offset = static_cast<int>(std::round((rng.nextFloat() * 2.0f - 1.0f) * timingJitter * 0.4f * static_cast<float>(baseInterval)));
                         jitteredInterval = juce::jmax(sliceLength + 1, baseInterval + offset);
                     }
                     stutterIntervalCounter[c] = jitteredInterval;
                 }
             }
 
-            if (stutterIsCapturing[c])
+            const auto capturing = stutterIsCapturing[c];
+            const auto playing = stutterIsPlaying[c];
+            const auto capturePos = stutterCapturePos[c];
+            const auto playPos = juce::jlimit(0, sliceLength - 1, stutterPlayPos[c]);
+
+            for (int l = 0; l < lanes; ++l)
+            {
+                auto* write = channelData[first + l];
+                auto& slice = stutterSliceBuffer[(size_t) (first + l)];
+                const auto in = write[i];
+                auto out = in;
+
+                if (capturing)
+                {
+                    slice.write(capturePos, in);
+                    out = in * inputDuck;
+                }
+                else if (playing)
+                {
+                    out = slice.read(playPos);
+                }
+
+                write[i] = juce::jlimit(-1.0f, 1.0f, saturate(out * juce::jmap(amount, 1.0f, 1.5f)));
+            }
+
+            if (capturing)
             {
-                slice[(size_t) stutterCapturePos[c]] = in;
                 ++stutterCapturePos[c];
-                out = in * inputDuck;
 
                 if (stutterCapturePos[c] >= sliceLength)
                 {
@@ -1723,9 +3550,8 @@ void DigitalisAudioProcessor::processClassicBufferStutter(juce::AudioBuffer<floa
                     stutterPlayPos[c] = stutterIsReverse[c] ? (sliceLength - 1) : 0;
                 }
             }
-            else if (stutterIsPlaying[c])
+            else if (playing)
             {
-                out = slice[(size_t) juce::jlimit(0, sliceLength - 1, stutterPlayPos[c])];
                 if (stutterIsReverse[c])
                     --stutterPlayPos[c];
                 else
@@ -1740,10 +3566,20 @@ void DigitalisAudioProcessor::processClassicBufferStutter(juce::AudioBuffer<floa
                         stutterIsPlaying[c] = false;
                 }
             }
+        }
 
-            write[i] = juce::jlimit(-1.0f, 1.0f, std::tanh(out * juce::jmap(amount, 1.0f, 1.5f)));
+        for (int l = 1; l < lanes; ++l)
+        {
+            const auto lane = static_cast<size_t>(first + l);
+            stutterCapturePos[lane] = stutterCapturePos[c];
+            stutterPlayPos[lane] = stutterPlayPos[c];
+            stutterRepeatsRemaining[lane] = stutterRepeatsRemaining[c];
+            stutterIntervalCounter[lane] = stutterIntervalCounter[c];
+            stutterIsCapturing[lane] = stutterIsCapturing[c];
+            stutterIsPlaying[lane] = stutterIsPlaying[c];
+            stutterIsReverse[lane] = stutterIsReverse[c];
         }
-    }
+    });
 }
 
 void DigitalisAudioProcessor::processMelodicSkippingEngine(juce::AudioBuffer<float>& buffer)
@@ -1763,90 +3599,155 @@ void DigitalisAudioProcessor::processMelodicSkippingEngine(juce::AudioBuffer<flo
                                         static_cast<int>(std::round(segMs * 0.001 * currentSampleRate)));
     const auto triggerProbPerSample = juce::jlimit(0.0f, 1.0f, (jumpRate / static_cast<float>(juce::jmax(1.0, currentSampleRate))) * (0.2f + 0.8f * skip));
     const auto skipDepth = std::pow(skip, 0.65f);
+    const auto crossingReach = static_cast<std::int64_t>(0.01 * currentSampleRate);
     constexpr std::array<int, 15> semitones { -24, -19, -12, -9, -7, -5, -3, 0, 3, 5, 7, 9, 12, 19, 24 };
 
-    for (int ch = 0; ch < channels; ++ch)
+    const auto linked = channels > 1 && parameters.getRawParameterValue("stereoLink")->load() >= 0.5f;
+    const auto lanes = linked ? channels : 1;
+    auto* const* channelData = buffer.getArrayOfWritePointers();
+
+    // Linked channels share the first channel's jumps, rate, direction and play position; each
+    // keeps its own history and blur filter.
+    forEachChannel(channels / lanes, [&](int group)
     {
-        const auto c = static_cast<size_t>(ch);
-        auto* write = buffer.getWritePointer(ch);
-        auto& mem = mskBuffer[c];
-        const auto memSize = static_cast<int>(mem.size());
+        const auto first = group * lanes;
+        const auto c = static_cast<size_t>(first);
+        auto& rng = channelRandom[c];
+        const auto memSize = mskBuffer[c].size();
         if (memSize <= 32)
-            continue;
+            return;
+
+        auto& jumpPoints = mskJumpPoints[c];
+        auto flutterPhase = mskFlutterPhase[c];
+        auto rubPhase = mskRubPhase[c];
 
         for (int i = 0; i < samples; ++i)
         {
-            const auto in = write[i];
-            mem[(size_t) mskWritePos[c]] = in;
+            // Both LFOs run whether or not a skip is playing.
+            const auto flutterAngle = flutterPhase;
+            const auto rubAngle = rubPhase;
+            flutterPhase += 0.0024f;
+            if (flutterPhase > juce::MathConstants<float>::twoPi)
+                flutterPhase -= juce::MathConstants<float>::twoPi;
+            rubPhase += 0.019f;
+            if (rubPhase > juce::MathConstants<float>::twoPi)
+                rubPhase -= juce::MathConstants<float>::twoPi;
+
+            std::array<float, 2> inputs {};
+            auto mix = 0.0f;
+            for (int l = 0; l < lanes; ++l)
+            {
+                inputs[(size_t) l] = channelData[first + l][i];
+                mskBuffer[(size_t) (first + l)].write(mskWritePos[c], inputs[(size_t) l]);
+                mix += inputs[(size_t) l];
+            }
             mskWritePos[c] = (mskWritePos[c] + 1) % memSize;
+            jumpPoints.push(mix);
 
-            if (mskRemaining[c] <= 0 && random.nextFloat() < triggerProbPerSample)
+            if (mskRemaining[c] <= 0 && rng.nextFloat() < triggerProbPerSample)
             {
                 const auto melodicSpan = juce::jlimit(1, static_cast<int>(semitones.size()) - 1,
                                                       2 + static_cast<int>(std::round(melody * (0.5f + spread) * 12.0f)));
                 const auto center = static_cast<int>(semitones.size() / 2);
                 const auto minIndex = juce::jmax(0, center - melodicSpan);
                 const auto maxIndex = juce::jmin(static_cast<int>(semitones.size()) - 1, center + melodicSpan);
-                const auto semitone = semitones[(size_t) juce::jlimit(minIndex, maxIndex, minIndex + random.nextInt(juce::jmax(1, maxIndex - minIndex + 1)))];
-                mskRate[c] = std::pow(2.0f, static_cast<float>(semitone) / 12.0f);
-                mskDirection[c] = (random.nextFloat() < reverseChance) ? -1 : 1;
+                const auto semitone = semitones[(size_t) juce::jlimit(minIndex, maxIndex, minIndex + rng.nextInt(juce::jmax(1, maxIndex - minIndex + 1)))];
+                mskRate[c] = sharedTables->semitoneRatios[(size_t) (semitone + 24)];
+                mskDirection[c] = (rng.nextFloat() < reverseChance) ? -1 : 1;
                 const auto lengthMul = juce::jmap(melody, 1.0f, 2.6f);
                 const auto baseLength = static_cast<int>(std::round(static_cast<float>(segLength) * lengthMul));
-                mskRemaining[c] = juce::jmax(16, baseLength + random.nextInt(juce::jmax(1, baseLength)));
+                mskRemaining[c] = juce::jmax(16, baseLength + rng.nextInt(juce::jmax(1, baseLength)));
 
                 const auto backMin = juce::jmax(segLength, static_cast<int>(0.03 * currentSampleRate));
                 const auto backMax = juce::jmin(memSize - 2, juce::jmax(backMin + 1, static_cast<int>(0.9 * currentSampleRate)));
-                const auto back = juce::jlimit(backMin, backMax, backMin + random.nextInt(juce::jmax(1, backMax - backMin + 1)));
+                auto back = juce::jlimit(backMin, backMax, backMin + rng.nextInt(juce::jmax(1, backMax - backMin + 1)));
+
+                // Land just ahead of the onset nearest the random pick if the window holds one, and
+                // on an upward zero crossing near there, so the jump neither starts mid-transient
+                // nor clicks. Without either the random pick stands.
+                const auto now = jumpPoints.now();
+                const auto earliest = now - backMax;
+                const auto latest = now - backMin;
+                auto target = now - back;
+                if (const auto onset = jumpPoints.nearestOnset(target, earliest, latest))
+                    target = *onset;
+                if (const auto crossing = jumpPoints.nearestCrossing(target, juce::jmax(earliest, target - crossingReach),
+                                                                     juce::jmin(latest, target + crossingReach)))
+                    target = *crossing;
+                back = static_cast<int>(now - target);
+
                 auto start = mskWritePos[c] - back;
                 while (start < 0)
                     start += memSize;
                 mskPlayPos[c] = static_cast<float>(start);
 
                 // Scratch-start tick accent.
-                write[i] = juce::jlimit(-1.0f, 1.0f, in + (random.nextFloat() * 2.0f - 1.0f) * (0.06f + 0.18f * skipDepth));
+                const auto tick = (rng.nextFloat() * 2.0f - 1.0f) * (0.06f + 0.18f * skipDepth);
+                for (int l = 0; l < lanes; ++l)
+                    channelData[first + l][i] = juce::jlimit(-1.0f, 1.0f, inputs[(size_t) l] + tick);
             }
 
-            auto y = in;
-            if (mskRemaining[c] > 0)
+            if (mskRemaining[c] <= 0)
             {
-                auto pos = mskPlayPos[c];
-                while (pos < 0.0f)
-                    pos += static_cast<float>(memSize);
-                while (pos >= static_cast<float>(memSize))
-                    pos -= static_cast<float>(memSize);
-
-                const auto p0 = static_cast<int>(pos);
-                const auto p1 = (p0 + 1) % memSize;
-                const auto frac = pos - static_cast<float>(p0);
-                const auto a = mem[(size_t) p0];
-                const auto b = mem[(size_t) p1];
-                auto seg = a + (b - a) * frac;
-
-                const auto lpf = juce::jmap(blur, 0.92f, 0.28f);
-                mskBlurState[c] = mskBlurState[c] * lpf + seg * (1.0f - lpf);
-                seg = juce::jmap(blur, seg, mskBlurState[c]);
-
-                if (random.nextFloat() < flutter * 0.018f)
-                    mskDirection[c] = -mskDirection[c];
-
-                if (random.nextFloat() < flutter * 0.01f)
-                    mskRate[c] = juce::jlimit(0.35f, 2.6f, mskRate[c] * (0.6f + random.nextFloat() * 1.2f));
-
-                const auto flutterMod = 1.0f + std::sin((processedSamples + i + ch * 59) * 0.0024f) * flutter * 0.24f;
-                auto advance = static_cast<float>(mskDirection[c]) * mskRate[c] * flutterMod;
-                advance += std::sin((processedSamples + i + ch * 13) * 0.019f) * flutter * 0.42f; // scratch rub
-                mskPlayPos[c] += advance;
-                --mskRemaining[c];
-
-                y = juce::jmap(skipDepth, in, seg);
-
-                if (random.nextFloat() < skip * flutter * 0.01f)
-                    y *= 0.2f; // scratch dropout notch
+                for (int l = 0; l < lanes; ++l)
+                    channelData[first + l][i] = juce::jlimit(-1.0f, 1.0f, saturate(inputs[(size_t) l] * juce::jmap(skipDepth, 1.0f, 2.1f)));
+
+                continue;
+            }
+
+            auto pos = mskPlayPos[c];
+            while (pos < 0.0f)
+                pos += static_cast<float>(memSize);
+            while (pos >= static_cast<float>(memSize))
+                pos -= static_cast<float>(memSize);
+
+            if (rng.nextFloat() < flutter * 0.018f)
+                mskDirection[c] = -mskDirection[c];
+
+            if (rng.nextFloat() < flutter * 0.01f)
+                mskRate[c] = juce::jlimit(0.35f, 2.6f, mskRate[c] * (0.6f + rng.nextFloat() * 1.2f));
+
+            const auto flutterMod = 1.0f + std::sin(flutterAngle) * flutter * 0.24f;
+            auto advance = static_cast<float>(mskDirection[c]) * mskRate[c] * flutterMod;
+            advance += std::sin(rubAngle) * flutter * 0.42f; // scratch rub
+            mskPlayPos[c] += advance;
+            --mskRemaining[c];
+
+            const auto dropout = rng.nextFloat() < skip * flutter * 0.01f ? 0.2f : 1.0f; // scratch dropout notch
+            const auto lpf = juce::jmap(blur, 0.92f, 0.28f);
+
+            for (int l = 0; l < lanes; ++l)
+            {
+                const auto lane = static_cast<size_t>(first + l);
+                auto* write = channelData[first + l];
+                const auto& mem = mskBuffer[lane];
+
+                auto seg = qualityTier == QualityTier::high ? mem.readSinc(pos, sharedTables->sincKernels.data())
+                                                            : mem.readInterpolated(pos);
+
+                mskBlurState[lane] = mskBlurState[lane] * lpf + seg * (1.0f - lpf);
+                seg = juce::jmap(blur, seg, mskBlurState[lane]);
+
+                const auto y = juce::jmap(skipDepth, inputs[(size_t) l], seg) * dropout;
+                write[i] = juce::jlimit(-1.0f, 1.0f, saturate(y * juce::jmap(skipDepth, 1.0f, 2.1f)));
             }
+        }
+
+        mskFlutterPhase[c] = flutterPhase;
+        mskRubPhase[c] = rubPhase;
 
-            write[i] = juce::jlimit(-1.0f, 1.0f, std::tanh(y * juce::jmap(skipDepth, 1.0f, 2.1f)));
+        for (int l = 1; l < lanes; ++l)
+        {
+            const auto lane = static_cast<size_t>(first + l);
+            mskFlutterPhase[lane] = mskFlutterPhase[c];
+            mskRubPhase[lane] = mskRubPhase[c];
+            mskWritePos[lane] = mskWritePos[c];
+            mskPlayPos[lane] = mskPlayPos[c];
+            mskRemaining[lane] = mskRemaining[c];
+            mskRate[lane] = mskRate[c];
+            mskDirection[lane] = mskDirection[c];
         }
-    }
+    });
 }
 
 float DigitalisAudioProcessor::crushSample(float x) const
@@ -1903,7 +3804,8 @@ float DigitalisAudioProcessor::deterministicSample(float x, int channel)
     return y;
 }
 
-juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
+template <>
+std::unique_ptr<juce::AudioProcessor> digitalis::dsp::detail::createEngine<kPluginIndex>()
 {
-    return new DigitalisAudioProcessor();
+    return std::make_unique<DigitalisAudioProcessor>();
 }
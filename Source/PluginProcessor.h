@@ -2,7 +2,428 @@
 
 #include <juce_audio_utils/juce_audio_utils.h>
 #include <juce_dsp/juce_dsp.h>
+#include "DigitalisKernels.h"
+#include "KernelDispatch.h"
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#ifndef DIGITALIS_COMPACT_HISTORY
+ #define DIGITALIS_COMPACT_HISTORY 1
+#endif
+
+// Flush denormals to zero for the duration of processBlock. Switching it off is only for the stress
+// tools, to see what the engines cost where a host or CPU does not honour flush-to-zero.
+#ifndef DIGITALIS_FLUSH_DENORMALS
+ #define DIGITALIS_FLUSH_DENORMALS 1
+#endif
+
+#ifndef DIGITALIS_PLUGIN_INDEX
+ #error "DIGITALIS_PLUGIN_INDEX must name the engine this code is compiled for"
+#endif
+
+// Times the per-sample members of DigitalisAudioProcessor; see Tools/KernelBenchMain.cpp.
+struct KernelBench;
+
+// digitalis_dsp compiles the processor once per engine into one library. Each copy sits in its own
+// inline namespace, so the copies do not collide at link time while the code here and in the
+// plugins still names the classes without qualification.
+inline namespace JUCE_JOIN_MACRO(digitalis_engine_, DIGITALIS_PLUGIN_INDEX)
+{
+// Circular sample history for the stutter and skip engines. With DIGITALIS_COMPACT_HISTORY the
+// samples are stored as 16-bit fixed point in blocks of 32 that share one scale, which halves the
+// memory and bandwidth of plain floats. Writes land in a float staging block that is packed once
+// the write position moves on, so reads of the newest samples stay exact.
+class HistoryBuffer
+{
+public:
+    void setSize(int numSamples)
+    {
+#if DIGITALIS_COMPACT_HISTORY
+        length = (juce::jmax(1, numSamples) + blockSize - 1) & ~blockMask;
+        packed.assign((size_t) length, 0);
+        scales.assign((size_t) (length / blockSize), 0.0f);
+        std::fill(staging.begin(), staging.end(), 0.0f);
+        stagingBlock = 0;
+#else
+        length = juce::jmax(1, numSamples);
+        samples.assign((size_t) length, 0.0f);
+#endif
+    }
+
+    // Silence at the current size, without reallocating.
+    void clear() noexcept
+    {
+#if DIGITALIS_COMPACT_HISTORY
+        std::fill(packed.begin(), packed.end(), std::int16_t { 0 });
+        std::fill(scales.begin(), scales.end(), 0.0f);
+        staging.fill(0.0f);
+        stagingBlock = 0;
+#else
+        std::fill(samples.begin(), samples.end(), 0.0f);
+#endif
+    }
+
+    int size() const noexcept { return length; }
+
+    void write(int index, float x) noexcept
+    {
+#if DIGITALIS_COMPACT_HISTORY
+        const auto block = index / blockSize;
+        if (block != stagingBlock)
+        {
+            packStaging();
+            stagingBlock = block;
+            unpackBlock(block, staging.data());
+        }
+        staging[(size_t) (index & blockMask)] = x;
+#else
+        samples[(size_t) index] = x;
+#endif
+    }
+
+    float read(int index) const noexcept
+    {
+#if DIGITALIS_COMPACT_HISTORY
+        const auto block = index / blockSize;
+        if (block == stagingBlock)
+            return staging[(size_t) (index & blockMask)];
+        return static_cast<float>(packed[(size_t) index]) * scales[(size_t) block];
+#else
+        return samples[(size_t) index];
+#endif
+    }
+
+    // Linear interpolation at a fractional position in [0, size()).
+    float readInterpolated(float position) const noexcept
+    {
+        const auto p0 = static_cast<int>(position);
+        const auto p1 = p0 + 1 < length ? p0 + 1 : 0;
+        const auto a = read(p0);
+        return a + (read(p1) - a) * (position - static_cast<float>(p0));
+    }
+
+    // Windowed-sinc interpolation at a fractional position in [0, size()). The kernel table holds
+    // sincPhases + 1 rows of sincTaps weights, for fractions 0, 1 / sincPhases, ... 1.
+    static constexpr int sincTaps = 8;
+    static constexpr int sincPhases = 256;
+
+    float readSinc(float position, const float* kernels) const noexcept
+    {
+        const auto p0 = static_cast<int>(position);
+        const auto phase = static_cast<int>((position - static_cast<float>(p0)) * sincPhases + 0.5f);
+        const auto* kernel = kernels + phase * sincTaps;
+        auto index = p0 - sincTaps / 2 + 1;
+        if (index < 0)
+            index += length;
+
+        auto sum = 0.0f;
+        for (int k = 0; k < sincTaps; ++k)
+        {
+            sum += read(index) * kernel[k];
+            if (++index == length)
+                index = 0;
+        }
+
+        return sum;
+    }
+
+private:
+#if DIGITALIS_COMPACT_HISTORY
+    static constexpr int blockSize = 32;
+    static constexpr int blockMask = blockSize - 1;
+
+    void packStaging() noexcept
+    {
+        auto range = juce::FloatVectorOperations::findMinAndMax(staging.data(), blockSize);
+        auto peak = juce::jmax(-range.getStart(), range.getEnd());
+
+        // An Inf, or a NaN that reached the peak, would make the block's scale non-finite and every
+        // sample in it unreadable. Such samples are stored as silence.
+        if (! (peak < std::numeric_limits<float>::infinity()))
+        {
+            digitalis::flushNonFinite(staging.data(), blockSize);
+            range = juce::FloatVectorOperations::findMinAndMax(staging.data(), blockSize);
+            peak = juce::jmax(-range.getStart(), range.getEnd());
+        }
+
+        const auto toFixed = peak > 0.0f ? 32767.0f / peak : 0.0f;
+        digitalis::kernels().packHistory(staging.data(), packed.data() + stagingBlock * blockSize, blockSize, toFixed);
+        scales[(size_t) stagingBlock] = peak / 32767.0f;
+    }
+
+    void unpackBlock(int block, float* dest) const noexcept
+    {
+        digitalis::kernels().unpackHistory(packed.data() + block * blockSize, dest, blockSize, scales[(size_t) block]);
+    }
+
+    std::vector<std::int16_t> packed;
+    std::vector<float> scales;
+    std::array<float, blockSize> staging {};
+    int stagingBlock = 0;
+#else
+    std::vector<float> samples;
+#endif
+    int length = 0;
+};
+
+// A memoryless waveshaper chain baked into a table over [-range, range] and read back with linear
+// interpolation. Inputs outside the range take the end values, so only chains that are flat out
+// there (ending in a clip) belong in one. bake() re-evaluates the chain only when its key changes.
+class TransferCurve
+{
+public:
+    static constexpr int intervals = 2048;
+
+    template <typename Chain>
+    void bake(const std::array<float, 4>& newKey, float newRange, Chain&& chain)
+    {
+        if (isBakedFor(newKey, newRange))
+            return;
+
+        for (int i = 0; i <= intervals; ++i)
+            table[(size_t) i] = chain(newRange * (2.0f * static_cast<float>(i) / static_cast<float>(intervals) - 1.0f));
+
+        table[(size_t) intervals + 1] = table[(size_t) intervals];
+        key = newKey;
+        range = newRange;
+        scale = static_cast<float>(intervals) / (2.0f * newRange);
+        baked = true;
+    }
+
+    bool isBakedFor(const std::array<float, 4>& k, float r) const noexcept
+    {
+        return baked && sameKey(k, key) && juce::exactlyEqual(r, range);
+    }
+
+    static bool sameKey(const std::array<float, 4>& a, const std::array<float, 4>& b) noexcept
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), [](float x, float y) { return juce::exactlyEqual(x, y); });
+    }
+
+    float operator()(float x) const noexcept
+    {
+        // NaN and Inf read the curve at 0 rather than an end of the table, which would hold the
+        // output at full scale. Tested on the exponent bits so process() still vectorises.
+        x = (std::bit_cast<std::uint32_t>(x) & 0x7f800000u) == 0x7f800000u ? 0.0f : x;
+        auto pos = (x + range) * scale;
+        pos = pos > 0.0f ? juce::jmin(pos, static_cast<float>(intervals)) : 0.0f;
+        const auto index = static_cast<int>(pos);
+        const auto frac = pos - static_cast<float>(index);
+        return table[(size_t) index] + frac * (table[(size_t) index + 1] - table[(size_t) index]);
+    }
+
+    void process(float* data, int numSamples) const noexcept
+    {
+        for (int i = 0; i < numSamples; ++i)
+            data[i] = (*this)(data[i]);
+    }
+
+private:
+    std::array<float, intervals + 2> table {};
+    std::array<float, 4> key {};
+    float range = 1.0f;
+    float scale = 0.0f;
+    bool baked = false;
+};
+
+// Jump targets in a history stream: upward zero crossings, at most one per crossingSpacing samples,
+// and onsets, where a fast envelope jumps well above a slow one. Both are kept as absolute sample
+// times in rings sized to hold everything the history can. Times only increase, so each ring is
+// sorted. push() is O(1) per sample, and a target is found by binary search with no history scan.
+class JumpPointIndex
+{
+public:
+    static constexpr int crossingSpacing = 16;
+
+    void prepare(double sampleRate, int historyLength)
+    {
+        const auto sr = static_cast<float>(sampleRate);
+        fastAttack = 1.0f - std::exp(-1.0f / (0.001f * sr));
+        fastRelease = std::exp(-1.0f / (0.02f * sr));
+        slowAttack = 1.0f - std::exp(-1.0f / (0.06f * sr));
+        slowRelease = std::exp(-1.0f / (0.06f * sr));
+        onsetHoldOff = juce::jmax(1, static_cast<int>(0.05f * sr));
+        onsetLead = static_cast<int>(0.002f * sr);
+
+        crossings.setCapacity(historyLength / crossingSpacing + 2);
+        onsets.setCapacity(historyLength / onsetHoldOff + 2);
+        clear();
+    }
+
+    // Forgets every recorded point and restarts the clock, keeping the ring storage.
+    void clear() noexcept
+    {
+        crossings.clear();
+        onsets.clear();
+        clock = 0;
+        previous = 0.0f;
+        fastEnv = 0.0f;
+        slowEnv = 0.0f;
+        rising = false;
+        lastCrossing = std::numeric_limits<std::int64_t>::min() / 2;
+        lastOnset = lastCrossing;
+    }
+
+    // Time of the next sample to be pushed.
+    std::int64_t now() const noexcept { return clock; }
+
+    void push(float x) noexcept
+    {
+        if (previous < 0.0f && x >= 0.0f && clock - lastCrossing >= crossingSpacing)
+        {
+            crossings.push(clock);
+            lastCrossing = clock;
+        }
+
+        const auto mag = std::abs(x);
+        fastEnv = digitalis::followEnvelope(fastEnv, mag, fastAttack, fastRelease);
+        slowEnv = digitalis::followEnvelope(slowEnv, mag, slowAttack, slowRelease);
+
+        // About 6 dB of rise above the recent level, above -40 dBFS, counted once per rise. The time
+        // is set back by the fast attack plus a little, so playback starts just ahead of the
+        // transient.
+        const auto wasRising = rising;
+        rising = fastEnv > 2.0f * slowEnv && fastEnv > 0.01f;
+        if (rising && ! wasRising && clock - lastOnset >= onsetHoldOff)
+        {
+            onsets.push(clock - onsetLead);
+            lastOnset = clock;
+        }
+
+        previous = x;
+        ++clock;
+    }
+
+    // The recorded time closest to target within [earliest, latest], if there is one.
+    std::optional<std::int64_t> nearestCrossing(std::int64_t target, std::int64_t earliest, std::int64_t latest) const noexcept
+    {
+        return crossings.nearest(target, earliest, latest);
+    }
+
+    std::optional<std::int64_t> nearestOnset(std::int64_t target, std::int64_t earliest, std::int64_t latest) const noexcept
+    {
+        return onsets.nearest(target, earliest, latest);
+    }
+
+private:
+    class TimeRing
+    {
+    public:
+        void setCapacity(int newCapacity)
+        {
+            times.assign((size_t) juce::jmax(1, newCapacity), 0);
+            clear();
+        }
+
+        void clear() noexcept
+        {
+            head = 0;
+            count = 0;
+        }
+
+        void push(std::int64_t time) noexcept
+        {
+            times[(size_t) head] = time;
+            head = head + 1 < (int) times.size() ? head + 1 : 0;
+            count = juce::jmin(count + 1, (int) times.size());
+        }
+
+        std::optional<std::int64_t> nearest(std::int64_t target, std::int64_t earliest, std::int64_t latest) const noexcept
+        {
+            target = juce::jlimit(earliest, latest, target);
+
+            // First entry at or after target; the nearest in range is it or the one before.
+            auto lo = 0;
+            auto hi = count;
+            while (lo < hi)
+            {
+                const auto mid = (lo + hi) / 2;
+                if (at(mid) < target)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+
+            std::optional<std::int64_t> best;
+            if (lo < count && at(lo) <= latest)
+                best = at(lo);
+            if (lo > 0 && at(lo - 1) >= earliest && (! best || target - at(lo - 1) < *best - target))
+                best = at(lo - 1);
+            return best;
+        }
+
+    private:
+        // Oldest first.
+        std::int64_t at(int index) const noexcept
+        {
+            auto slot = head - count + index;
+            if (slot < 0)
+                slot += (int) times.size();
+            return times[(size_t) slot];
+        }
+
+        std::vector<std::int64_t> times;
+        int head = 0;
+        int count = 0;
+    };
+
+    TimeRing crossings;
+    TimeRing onsets;
+    std::int64_t clock = 0;
+    std::int64_t lastCrossing = 0;
+    std::int64_t lastOnset = 0;
+    float previous = 0.0f;
+    float fastEnv = 0.0f;
+    float slowEnv = 0.0f;
+    float fastAttack = 1.0f;
+    float fastRelease = 0.0f;
+    float slowAttack = 1.0f;
+    float slowRelease = 0.0f;
+    int onsetHoldOff = 1;
+    int onsetLead = 0;
+    bool rising = false;
+};
+
+// Helper threads shared by every instance in the process, used to run channels side by side
+// during offline renders. The caller and the helpers claim channel indices from one counter, so
+// whichever thread is free takes the next channel. One job runs at a time: an instance that finds
+// the helpers busy runs its channels itself rather than waiting. Threads start on first use, so
+// instances that never render offline cost nothing.
+class ChannelWorkers
+{
+public:
+    using Task = void (*)(void* context, int channel);
+
+    ChannelWorkers() = default;
+    ~ChannelWorkers();
+
+    // Runs task for every channel in [0, numChannels) and returns once all of them are done, or
+    // returns false without running anything if another instance holds the helpers.
+    bool tryRun(int numChannels, Task task, void* context);
+
+private:
+    void workerLoop(int index);
+    void runClaimedChannels();
+
+    std::atomic<bool> busy { false };
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::uint64_t generation = 0;
+    bool stopping = false;
+    int helpersWanted = 0;
+    int helpersFinished = 0;
+
+    Task task = nullptr;
+    void* context = nullptr;
+    int numChannels = 0;
+    std::atomic<int> nextChannel { 0 };
+};
 
 class DigitalisAudioProcessor final : public juce::AudioProcessor
 {
@@ -12,6 +433,7 @@ public:
 
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void reset() override;
 
     bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
 
@@ -38,47 +460,162 @@ public:
     juce::AudioProcessorValueTreeState& getValueTreeState() noexcept { return parameters; }
     const juce::AudioProcessorValueTreeState& getValueTreeState() const noexcept { return parameters; }
 
+    // The editor is built into the plugin targets only; each one installs its factory from
+    // createPluginFilter (Source/PluginEntry.cpp). Without one, as in digitalis_dsp, there is none.
+    using EditorFactory = juce::AudioProcessorEditor* (*)(DigitalisAudioProcessor&);
+    static inline std::atomic<EditorFactory> editorFactory { nullptr };
+
 private:
-    struct PresetParam
+    friend struct ::KernelBench;
+
+    // Parameters addressed by the FNV-1a hash of their ID, sorted for lookup. The binary state
+    // stores these hashes instead of ID strings.
+    struct StateSlot
     {
-        const char* id;
-        float value;
+        std::uint32_t idHash;
+        juce::RangedAudioParameter* parameter;
+        std::atomic<float>* value;
     };
 
-    struct FactoryPreset
+    struct PendingValue
     {
-        const char* name;
-        std::vector<PresetParam> values;
+        juce::RangedAudioParameter* parameter;
+        float normalised;
     };
 
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
-    static std::vector<FactoryPreset> createFactoryPresets();
+    static void addEngineParameters(std::vector<std::unique_ptr<juce::RangedAudioParameter>>& params, int engine);
     void applyFactoryPreset(size_t index);
+    const StateSlot* findStateSlot(std::uint32_t idHash) const;
+    void queueParameterValue(std::uint32_t idHash, float value);
+    void queueParameterValue(juce::RangedAudioParameter& parameter, float value);
+    void flushParameterValues();
 
+    void processEngine(int engine, juce::AudioBuffer<float>& buffer);
     void processFloatingPointCollapse(juce::AudioBuffer<float>& buffer);
     void processNyquistDestroyer(juce::AudioBuffer<float>& buffer);
     void processBufferGlitchEngine(juce::AudioBuffer<float>& buffer);
     void processAutomationQuantiser(juce::AudioBuffer<float>& buffer);
-    void processStreamingArtifactGenerator(juce::AudioBuffer<float>& buffer);
+    void processStreamingArtifactGenerator(juce::AudioBuffer<float>& buffer, bool codecEnabled = true);
+
+    // Transform scratch for one channel of the codec, so channels can run their frames on
+    // different threads. The FFT is only created by targets that run the codec.
+    struct SagScratch
+    {
+        std::optional<juce::dsp::FFT> fft;
+        std::vector<float> fold;
+        std::vector<float> coeffs;
+        std::vector<float> time;
+        std::vector<juce::dsp::Complex<float>> fftIn;
+        std::vector<juce::dsp::Complex<float>> fftOut;
+    };
+
+    void sagDctIV(SagScratch& scratch, const float* input, float* output);
+    void sagForwardMdct(SagScratch& scratch, const float* input, float* coeffs);
+    void sagInverseMdct(SagScratch& scratch, const float* coeffs, float* output);
     void processFFTBrutalist(juce::AudioBuffer<float>& buffer);
     void processOverclockFailure(juce::AudioBuffer<float>& buffer);
     void processDeterministicMachine(juce::AudioBuffer<float>& buffer);
     void processClassicBufferStutter(juce::AudioBuffer<float>& buffer);
     void processMelodicSkippingEngine(juce::AudioBuffer<float>& buffer);
     void applyPostSafety(juce::AudioBuffer<float>& buffer);
+    void updateReportedLatency();
+    void applyLookaheadLimiter(juce::AudioBuffer<float>& buffer, float ceiling);
+    void applyLimiterDelay(juce::AudioBuffer<float>& buffer);
+    void setLimiterActive(bool shouldBeActive);
+    void resetLimiter();
+    void resetLimiterDetector();
+    // Zeroes every delay line, filter and envelope in place. No allocation and no latency change,
+    // so hosts may call it through reset() on the audio thread.
+    void clearState();
+    // Per-sample form of the float damage stage. processFloatingPointCollapse runs the rounding
+    // chaos per sample and the mantissa and exponent quantisers over whole chunks.
     float applyFloatDamage(float x, int mantissaBits, int exponentStep, float roundingAmount);
+    float applyRoundingChaos(float x, float roundingAmount);
     float applyNonlinearQuantiser(float x, int mode, float amount);
 
+    // Silence handling. Once the input has been silent for longer than the active engines can still
+    // play back, and their feedback paths have died away, processBlock clears the output and skips
+    // the DSP entirely. Memory is measured at the current parameter values.
+    bool shouldSleep(const juce::AudioBuffer<float>& buffer);
+    int engineMemorySamples(int engine) const;
+    bool engineStateIsQuiet(int engine) const;
+    bool engineGeneratesFromSilence(int engine) const;
+
     float crushSample(float x) const;
     float aliasSample(float x, int channel, int sampleInBlock);
     float gridSample(float x, int sampleInBlock);
     float dropoutSample(float x);
     float deterministicSample(float x, int channel);
 
+    // Kernel quality. Auto follows isNonRealtime(): cheaper kernels while playing live, the exact
+    // ones during bounces. The tier is resolved once per block, and prepareToPlay builds what every
+    // tier needs, so switching allocates nothing.
+    enum class QualityTier
+    {
+        draft,
+        high
+    };
+
+    QualityTier selectQualityTier() const;
+    float saturate(float x) const noexcept;
+    void saturateBlock(float* data, int numSamples) const noexcept;
+
+    // Runs fn(channel) for each of the first numChannels channels. During offline renders with
+    // Offline Threads on, the channels are spread over the shared helper threads and joined before
+    // returning; otherwise they run in order here. Engines handed to this keep every piece of
+    // per-channel state, their random generator included, in per-channel slots, so the result is
+    // the same whichever thread runs a channel.
+    template <typename Fn>
+    void forEachChannel(int numChannels, Fn&& fn)
+    {
+        const ChannelWorkers::Task task = [](void* context, int channel) { (*static_cast<std::remove_reference_t<Fn>*>(context))(channel); };
+
+        if (channelThreadsActive && numChannels > 1 && channelWorkers->tryRun(numChannels, task, &fn))
+            return;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            fn(ch);
+    }
+
+    // NyquistDestroyer runs 2x oversampled in the high tier. Both tiers report the oversampler's
+    // latency (draft delays its output to match), and a switch crossfades from the old path to the
+    // new one, so nothing jumps when the tier changes mid-stream.
+    // Each hold step can be replaced by a band-limited one: the minimum-phase step residual below
+    // is added after the step and decays to nothing within nyqBlepLength samples.
+    static constexpr int nyqBlepLength = 16;
+
+    struct NyquistState
+    {
+        std::array<float, 2> heldCurrent { 0.0f, 0.0f };
+        std::array<float, 2> heldPrevious { 0.0f, 0.0f };
+        std::array<int, 2> holdCounter { 1, 1 };
+        std::array<std::array<float, nyqBlepLength>, 2> blepRing {};
+        std::array<int, 2> blepPos { 0, 0 };
+        std::array<float, 2> feedbackState { 0.0f, 0.0f };
+        std::array<float, 2> feedbackToneState { 0.0f, 0.0f };
+        float phase = 0.0f;
+        float transientEnv = 0.0f;
+        int holdSamples = 1;
+        int modulationCountdown = 0;
+    };
+
+    void runNyquistCore(const juce::dsp::AudioBlock<float>& block, NyquistState& nyq, QualityTier tier);
+    void runNyquistTier(juce::dsp::AudioBlock<float> block, NyquistState& nyq, QualityTier tier);
+
+    // Control-rate updates (auto level, stress envelopes) tick every controlBlockSize samples on a
+    // grid that carries across processBlock calls, with coefficients scaled from the per-block
+    // values tuned at referenceBlockSize. This keeps behaviour independent of the host block size.
+    static constexpr int controlBlockSize = 32;
+    static constexpr int referenceBlockSize = 512;
+
     juce::AudioProcessorValueTreeState parameters;
 
-    juce::dsp::DryWetMixer<float> dryWet;
+    juce::dsp::DryWetMixer<float> dryWet { sagLatencySamples + limiterMaxLatencySamples };
     juce::Random random;
+    std::array<juce::Random, 2> channelRandom; // seeded from random in prepareToPlay
+    juce::SharedResourcePointer<ChannelWorkers> channelWorkers;
+    bool channelThreadsActive = false;
 
     std::array<float, 2> heldSamples { 0.0f, 0.0f };
     std::array<int, 2> heldCountdown { 0, 0 };
@@ -90,49 +627,126 @@ private:
     std::array<int, 2> microLoopReadPos { 0, 0 };
     float fpcChaoticState = 0.371f;
     int denormalBurstRemaining = 0;
-    std::array<float, 2> nyqHeldCurrent { 0.0f, 0.0f };
-    std::array<float, 2> nyqHeldPrevious { 0.0f, 0.0f };
-    std::array<int, 2> nyqHoldCounter { 1, 1 };
-    std::array<float, 2> nyqFeedbackState { 0.0f, 0.0f };
-    std::array<float, 2> nyqFeedbackToneState { 0.0f, 0.0f };
-    float nyqPhase = 0.0f;
-    float nyqTransientEnv = 0.0f;
+    NyquistState nyqState;
+    NyquistState nyqFadeState;
+    std::unique_ptr<juce::dsp::Oversampling<float>> nyqOversampler; // Nyquist target only
+    int nyqLatency = 0;
+    std::array<std::vector<float>, 2> nyqAlignDelay;
+    int nyqAlignPos = 0;
+    juce::AudioBuffer<float> nyqFadeBuffer;
+    QualityTier nyqTier = QualityTier::draft;
+    QualityTier nyqFadeTier = QualityTier::draft;
+    int nyqFadePos = 0;
+    static constexpr int nyqFadeSamples = 64;
+    static constexpr int bgeMaxChunk = 1024; // jittered chunks are clamped to this
     std::array<std::vector<float>, 2> bgePrevChunk;
+    std::vector<float> bgeChunk;
     std::array<float, 2> bgeEnvelope { 0.0f, 0.0f };
     int bgePrevChunkSize = 0;
     bool bgeHasPrevChunk = false;
     std::array<float, 2> aqHeldAmp { 1.0f, 1.0f };
     std::array<int, 2> aqHeldCounter { 1, 1 };
     std::array<float, 2> aqLfoPhase { 0.0f, 0.0f };
-    std::array<float, 2> sagToneState { 0.0f, 0.0f };
+    std::array<juce::int64, 2> aqBeatNextStep { 0, 0 };
+    std::array<int, 2> aqBeatJitter { 0, 0 };
+    double aqBeatExpectedPos = 0.0;
+    double aqBeatFreePpq = 0.0;
+    bool aqBeatNeedsSync = true;
     std::array<float, 2> sagSmearState { 0.0f, 0.0f };
-    std::array<float, 2> sagLastFrameSample { 0.0f, 0.0f };
     std::array<float, 2> sagTransientEnv { 0.0f, 0.0f };
     int sagCodec = 0;
     int sagCodecCounter = 0;
     int sagLossBurstRemaining = 0;
-    static constexpr int fftBrutalistOrder = 10;
-    static constexpr int fftBrutalistSize = 1 << fftBrutalistOrder;
-    juce::dsp::FFT fftBrutalistFft { fftBrutalistOrder };
-    juce::dsp::WindowingFunction<float> fftBrutalistWindow { fftBrutalistSize, juce::dsp::WindowingFunction<float>::hann, false };
-    std::array<std::vector<juce::dsp::Complex<float>>, 2> fftBrutalistFrozenSpectrum;
+    int sagFrameRemaining = 0;
+    int sagLostFrames = 0;
+    static constexpr int sagMdctOrder = 7;
+    static constexpr int sagMdctSize = 2 << sagMdctOrder;
+    static constexpr int sagPreEchoTaps = 8;
+    static constexpr int sagLatencySamples = 2 * sagMdctSize + sagPreEchoTaps;
+    static constexpr int sagMaxBands = 25;
+    std::array<SagScratch, 2> sagScratch;
+    std::array<std::vector<float>, 2> sagFrameInput;
+    std::array<std::vector<float>, 2> sagFrameOutput;
+    std::array<std::vector<float>, 2> sagOverlap;
+    std::array<std::vector<float>, 2> sagLastCoeffs;
+    // The codec output and the pre-echo each sample sends back, delayed by sagPreEchoTaps so the
+    // pre-echo can be rendered forward. The first sagPreEchoTaps entries carry over between chunks.
+    std::array<std::vector<float>, 2> sagPreEchoOut;
+    std::array<std::vector<float>, 2> sagPreEchoSource;
+    std::array<int, sagMaxBands + 1> sagBandEdges {};
+    int sagNumBands = 0;
+
+    // Read-only tables that do not depend on sample rate or parameters. One copy is built by the
+    // first instance in the process and shared by all of them until the last one goes away.
+    // FFT engines stay per instance: juce::dsp::FFT serialises perform() behind a lock.
+    struct SharedTables
+    {
+        SharedTables();
+
+        std::array<float, 2 * sagMdctSize> mdctWindow {};
+        std::array<juce::dsp::Complex<float>, sagMdctSize / 2> mdctPreTwiddle {};
+        std::array<juce::dsp::Complex<float>, sagMdctSize / 2> mdctPostTwiddle {};
+        std::array<float, 49> semitoneRatios {}; // 2^(n / 12) for n in [-24, 24]
+        std::array<float, (HistoryBuffer::sincPhases + 1) * HistoryBuffer::sincTaps> sincKernels {};
+        std::array<float, nyqBlepLength> stepResidual {}; // minimum-phase band-limited step minus the ideal step
+    };
+
+    juce::SharedResourcePointer<SharedTables> sharedTables;
     std::array<int, 2> fftBrutalistFreezeRemaining { 0, 0 };
+    std::array<float, 2> fftBrutalistFreezeValue { 0.0f, 0.0f };
+    std::array<float, 2> fftBrutalistHeld { 0.0f, 0.0f };
+    std::array<int, 2> fftBrutalistHoldCounter { 0, 0 };
+    std::array<float, 2> fftBrutalistPhase { 0.0f, 0.0f };
     std::array<std::vector<float>, 2> ocfDelayLine;
     std::array<int, 2> ocfDelayWritePos { 0, 0 };
     std::array<int, 2> ocfDelayReadOffset { 1, 1 };
     std::array<float, 2> ocfHoldValue { 0.0f, 0.0f };
     std::array<int, 2> ocfHoldRemaining { 0, 0 };
+    std::array<float, 2> ocfDriftPhase { 0.0f, 0.0f }; // radians, wrapped at 2 pi
     float ocfThermalState = 0.0f;
     float ocfStressEnv = 0.0f;
-    std::array<std::vector<float>, 2> dmLoopBuffer;
+    float ocfControlEnergy = 0.0f;
+    int ocfControlCountdown = controlBlockSize;
+    std::array<std::vector<float>, 2> dmLoopBuffer; // sized for the longest loop; dmLoopLength is in use
+    int dmLoopLength = 0;
     std::array<int, 2> dmLoopWritePos { 0, 0 };
     std::array<int, 2> dmLoopReadPos { 0, 0 };
     int dmStateIndex = 0;
     int dmSamplesToNextState = 0;
     int dmHashCounter = 0;
-    std::uint32_t dmHashState = 2166136261u;
+    std::array<std::uint32_t, 4> dmHashLanes {};
     float dmStateSmoother = 0.0f;
-    std::array<std::vector<float>, 2> stutterSliceBuffer;
+
+    // Per-state output settings, rebuilt when the state count or determinism changes.
+    struct DmStateParams
+    {
+        float gainTarget = 1.0f;
+        float crushSteps = 1024.0f;
+        float loopBlend = 0.0f;
+        float fold = 0.0f; // radians per unit of input
+        float levels = 2.0f;
+    };
+
+    static constexpr int dmMaxStates = 128;
+    std::array<DmStateParams, dmMaxStates> dmStateTable {};
+    int dmTableStateCount = 0;
+    float dmTableDeterminism = 0.0f;
+
+    // The first quantiser makes the rest of the state's output chain a function of one integer,
+    // round(x * crushSteps). Its values are filled in as they are first hit and dropped when the
+    // chain changes; NaN marks an entry not yet filled, and only the touched span is cleared.
+    static constexpr int dmCurveReach = 2048;
+    std::array<float, 2 * dmCurveReach + 1> dmCurve {};
+    int dmCurveLo = 0; // touched span, as indices into dmCurve
+    int dmCurveHi = -1;
+    int dmCurveState = -1;
+    QualityTier dmCurveTier = QualityTier::draft;
+
+    TransferCurve postSafetyCurve;
+    // Key the post-safety table is waiting to be baked for, and how long it has held still.
+    std::array<float, 4> postCurvePendingKey {};
+    int postCurveSettledSamples = 0;
+    std::array<HistoryBuffer, 2> stutterSliceBuffer;
     std::array<int, 2> stutterCapturePos { 0, 0 };
     std::array<int, 2> stutterPlayPos { 0, 0 };
     std::array<int, 2> stutterRepeatsRemaining { 0, 0 };
@@ -140,20 +754,55 @@ private:
     std::array<bool, 2> stutterIsCapturing { false, false };
     std::array<bool, 2> stutterIsPlaying { false, false };
     std::array<bool, 2> stutterIsReverse { false, false };
-    std::array<std::vector<float>, 2> mskBuffer;
+    std::array<HistoryBuffer, 2> mskBuffer;
     std::array<int, 2> mskWritePos { 0, 0 };
     std::array<float, 2> mskPlayPos { 0.0f, 0.0f };
     std::array<int, 2> mskRemaining { 0, 0 };
     std::array<float, 2> mskRate { 1.0f, 1.0f };
     std::array<int, 2> mskDirection { 1, 1 };
     std::array<float, 2> mskBlurState { 0.0f, 0.0f };
+    std::array<float, 2> mskFlutterPhase { 0.0f, 0.0f }; // radians, wrapped at 2 pi
+    std::array<float, 2> mskRubPhase { 0.0f, 0.0f };
+    std::array<JumpPointIndex, 2> mskJumpPoints;
     std::array<float, 2> postDcPrevInput { 0.0f, 0.0f };
     std::array<float, 2> postDcPrevOutput { 0.0f, 0.0f };
     float postAutoLevelGain = 1.0f;
-    std::vector<FactoryPreset> factoryPresets;
+    float postLevelMeanSquare = 0.0f;
+    float postControlSumSq = 0.0f;
+    int postControlCountdown = controlBlockSize;
+    // Optional lookahead limiter after the post-safety gain. Peaks (with a 4x interpolated
+    // inter-sample estimate) feed a monotonic-deque sliding maximum; the resulting gain is ramped
+    // down over limiterRamp samples by a running box average, so the audio is delayed by
+    // limiterRamp + 1 samples. Bypassed, the audio goes through the same delay, so the reported
+    // latency doesn't depend on the switch.
+    static constexpr int limiterMaxLatencySamples = 512;
+    bool limiterActive = false;
+    int limiterRamp = 64;
+    std::array<std::vector<float>, 2> limiterDelay;
+    std::array<std::array<float, 3>, 2> limiterHistory {};
+    std::vector<float> limiterPeakValues;
+    std::vector<std::uint32_t> limiterPeakTimes;
+    int limiterPeakHead = 0;
+    int limiterPeakCount = 0;
+    std::vector<float> limiterGainRing;
+    double limiterGainSum = 0.0;
+    float limiterGain = 1.0f;
+    int limiterDelayPos = 0;
+    int limiterRampPos = 0;
+    std::uint32_t limiterClock = 0;
+    // Sized for the largest layout (the chain) so construction needs no allocations of its own.
+    static constexpr int maxParameters = 40;
+    std::array<juce::RangedAudioParameter*, maxParameters> layoutParameters {};
+    std::array<StateSlot, maxParameters> stateSlots {};
+    std::array<PendingValue, maxParameters> pendingValues {};
+    int numPendingValues = 0;
     int currentProgramIndex = 0;
 
+    QualityTier qualityTier = QualityTier::draft;
     double currentSampleRate = 44100.0;
     int maxBlockSize = 512;
     int processedSamples = 0;
+    int silentInputSamples = 0;
+    float lastOutputPeak = 0.0f;
 };
+} // inline namespace
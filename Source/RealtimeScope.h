@@ -0,0 +1,24 @@
+#pragma once
+
+#ifndef DIGITALIS_RT_SANITIZER
+ #define DIGITALIS_RT_SANITIZER 0
+#endif
+
+namespace digitalis
+{
+// Marks the calling thread as running audio code for as long as it lives. processBlock opens one in
+// sanitizer builds (DIGITALIS_RT_SANITIZER); Tools/RealtimeCheckMain.cpp interposes the allocator,
+// locks and blocking calls and reports any that happen while a scope is open on their thread.
+struct RealtimeScope
+{
+    RealtimeScope() noexcept { ++depth; }
+    ~RealtimeScope() { --depth; }
+
+    RealtimeScope(const RealtimeScope&) = delete;
+    RealtimeScope& operator=(const RealtimeScope&) = delete;
+
+    static bool isActive() noexcept { return depth > 0; }
+
+    inline static thread_local int depth = 0;
+};
+} // namespace digitalis
@@ -0,0 +1,426 @@
+#include "../Source/PluginProcessor.h"
+#include "../Source/DigitalisKernels.h"
+#include "../Source/KernelDispatch.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+// Times the sample-level kernels one at a time, away from the engines around them. Each kernel
+// runs over a fixed buffer: a few untimed passes warm the caches and branch predictors, then every
+// repetition times enough passes to last about a millisecond. Results are the median ns/sample over
+// the repetitions and its median absolute deviation, so a stray interrupt moves neither. Where the
+// tree has two forms of a kernel (a scalar reference and the lane or table form the engines use)
+// both are listed under the same name. The dispatched block kernels are listed once per
+// instruction-set variant this CPU can run; --isa forces one variant for the whole run, including
+// the kernels the plugin code calls through the dispatch table.
+//
+//   KernelBench<Plugin> [--cpu n] [--reps n] [--samples n] [--only substring] [--isa name]
+namespace
+{
+struct Options
+{
+    int cpu = 0;
+    int repetitions = 31;
+    int warmupPasses = 8;
+    int samples = 4096;
+    juce::String only;
+    juce::String isa; // empty: list every variant the CPU runs
+};
+
+struct Result
+{
+    double median = 0.0;
+    double mad = 0.0;
+};
+
+double medianOf(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const auto mid = values.size() / 2;
+    return values.size() % 2 != 0 ? values[mid] : 0.5 * (values[mid - 1] + values[mid]);
+}
+
+// Results are folded into this so the optimiser cannot drop a kernel whose output goes unused.
+volatile float sink = 0.0f;
+
+Result measure(const Options& options, int samplesPerPass, const std::function<void()>& pass)
+{
+    using Clock = std::chrono::steady_clock;
+
+    for (int i = 0; i < options.warmupPasses; ++i)
+        pass();
+
+    // Grow the pass count until one repetition is long enough for the clock to resolve well.
+    auto passes = 1;
+    for (;;)
+    {
+        const auto start = Clock::now();
+        for (int i = 0; i < passes; ++i)
+            pass();
+        if (Clock::now() - start >= std::chrono::milliseconds(1) || passes >= (1 << 20))
+            break;
+        passes *= 2;
+    }
+
+    std::vector<double> nsPerSample;
+    nsPerSample.reserve((size_t) options.repetitions);
+
+    for (int r = 0; r < options.repetitions; ++r)
+    {
+        const auto start = Clock::now();
+        for (int i = 0; i < passes; ++i)
+            pass();
+        const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        nsPerSample.push_back(elapsed / (static_cast<double>(passes) * samplesPerPass));
+    }
+
+    Result result;
+    result.median = medianOf(nsPerSample);
+    for (auto& v : nsPerSample)
+        v = std::abs(v - result.median);
+    result.mad = medianOf(nsPerSample);
+    return result;
+}
+
+void report(const Options& options, const char* kernel, const char* variant, int samplesPerPass,
+            const std::function<void()>& pass)
+{
+    const auto name = juce::String(kernel) + " " + variant;
+    if (options.only.isNotEmpty() && ! name.containsIgnoreCase(options.only))
+        return;
+
+    const auto result = measure(options, samplesPerPass, pass);
+    std::printf("%-28s %-10s %10.3f %10.3f\n", kernel, variant, result.median, result.mad);
+    std::fflush(stdout);
+}
+
+// Programme-like test signal: two sines under noise, peaking just below full scale.
+std::vector<float> makeSignal(int numSamples)
+{
+    juce::Random rng(0x5eed);
+    std::vector<float> signal((size_t) numSamples);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto t = static_cast<float>(i);
+        signal[(size_t) i] = 0.5f * std::sin(t * 0.0131f) + 0.25f * std::sin(t * 0.291f)
+                           + 0.2f * (rng.nextFloat() * 2.0f - 1.0f);
+    }
+    return signal;
+}
+} // namespace
+
+struct KernelBench
+{
+    static void run(DigitalisAudioProcessor& processor, const Options& options)
+    {
+        using namespace digitalis;
+
+        const auto n = options.samples;
+        const auto input = makeSignal(n);
+        std::vector<float> output((size_t) n);
+        const auto* in = input.data();
+        auto* out = output.data();
+        const auto settle = [&] { sink = sink + out[(size_t) n / 2]; };
+
+        std::printf("%-28s %-10s %10s %10s\n", "kernel", "variant", "ns/sample", "MAD");
+
+        report(options, "quantise", "scalar", n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = quantise(in[i], 255.0f);
+            settle();
+        });
+
+        report(options, "truncateMantissa", "scalar", n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = truncateMantissa(in[i], 7);
+            settle();
+        });
+
+        report(options, "quantiseExponent", "scalar", n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = quantiseExponent(in[i], 3);
+            settle();
+        });
+
+        // One lane is the plain serial FNV-1a chain; four is what DeterministicMachine runs.
+        report(options, "hashSamples", "1 lane", n, [&]
+        {
+            std::array<std::uint32_t, 1> lanes {};
+            seedHashLanes(lanes, 2166136261u);
+            hashSamples(lanes, 0, in, n);
+            sink = sink + static_cast<float>(foldHashLanes(lanes) & 1u);
+        });
+
+        report(options, "hashSamples", "4 lanes", n, [&]
+        {
+            std::array<std::uint32_t, 4> lanes {};
+            seedHashLanes(lanes, 2166136261u);
+            hashSamples(lanes, 0, in, n);
+            sink = sink + static_cast<float>(foldHashLanes(lanes) & 1u);
+        });
+
+        // Block kernels, per variant. Each pass copies the test signal in first, since most of
+        // them work in place; the copy is the same for every variant.
+        std::vector<std::int16_t> packed((size_t) n);
+        for (const auto* table : availableKernels())
+        {
+            if (options.isa.isNotEmpty() && ! options.isa.equalsIgnoreCase(table->name))
+                continue;
+
+            const auto& k = *table;
+
+            report(options, "sumOfSquares", k.name, n, [&]
+            {
+                sink = sink + k.sumOfSquares(in, n);
+            });
+
+            report(options, "saturateDraft", k.name, n, [&]
+            {
+                std::copy(in, in + n, out);
+                k.saturateDraft(out, n);
+                settle();
+            });
+
+            report(options, "quantise", k.name, n, [&]
+            {
+                std::copy(in, in + n, out);
+                k.quantise(out, n, 255.0f);
+                settle();
+            });
+
+            report(options, "truncateMantissa", k.name, n, [&]
+            {
+                std::copy(in, in + n, out);
+                k.truncateMantissa(out, n, 7);
+                settle();
+            });
+
+            report(options, "quantiseExponent", k.name, n, [&]
+            {
+                std::copy(in, in + n, out);
+                k.quantiseExponent(out, n, 3);
+                settle();
+            });
+
+            report(options, "packHistory", k.name, n, [&]
+            {
+                k.packHistory(in, packed.data(), n, 32767.0f);
+                sink = sink + static_cast<float>(packed[(size_t) n / 2]);
+            });
+
+            report(options, "unpackHistory", k.name, n, [&]
+            {
+                k.unpackHistory(packed.data(), out, n, 1.0f / 32767.0f);
+                settle();
+            });
+        }
+
+        report(options, "followEnvelope", "scalar", n, [&]
+        {
+            auto env = 0.0f;
+            for (int i = 0; i < n; ++i)
+                out[i] = env = followEnvelope(env, std::abs(in[i]), 0.35f, 0.9965f);
+            settle();
+        });
+
+        report(options, "applyFloatDamage", "exact", n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = processor.applyFloatDamage(in[i], 8, 2, 0.0f);
+            settle();
+        });
+
+        report(options, "applyFloatDamage", "rounding", n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = processor.applyFloatDamage(in[i], 8, 2, 0.5f);
+            settle();
+        });
+
+        static constexpr const char* quantiserModes[] = { "uniform", "log", "mu-law", "chaotic" };
+        for (int mode = 0; mode < 4; ++mode)
+            report(options, "applyNonlinearQuantiser", quantiserModes[mode], n, [&]
+            {
+                for (int i = 0; i < n; ++i)
+                    out[i] = processor.applyNonlinearQuantiser(in[i], mode, 0.5f);
+                settle();
+            });
+
+        using Tier = DigitalisAudioProcessor::QualityTier;
+        const auto savedTier = processor.qualityTier;
+
+        for (const auto tier : { Tier::draft, Tier::high })
+        {
+            processor.qualityTier = tier;
+            report(options, "saturate", tier == Tier::high ? "high" : "draft", n, [&]
+            {
+                for (int i = 0; i < n; ++i)
+                    out[i] = processor.saturate(in[i] * 2.5f);
+                settle();
+            });
+        }
+
+        // The post-safety shaper as written out per sample, against the baked table the plugin
+        // uses when the limiter is off. Both run at the draft tier, as playback does.
+        processor.qualityTier = Tier::draft;
+        const auto drive = juce::jmap(0.5f, 1.0f, 4.2f);
+        const auto softNorm = 1.0f / std::tanh(drive);
+        const auto hardLimit = juce::jmap(0.5f, 0.995f, 0.8f);
+        const auto shaper = [&](float y) { return juce::jlimit(-hardLimit, hardLimit, processor.saturate(y * drive) * softNorm); };
+
+        report(options, "postSafetyShaper", "direct", n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = shaper(in[i]);
+            settle();
+        });
+
+        TransferCurve curve;
+        curve.bake({ drive, hardLimit, 0.0f, 0.0f }, 1.0f, shaper);
+
+        report(options, "postSafetyShaper", "table", n, [&]
+        {
+            std::copy(in, in + n, out);
+            curve.process(out, n);
+            settle();
+        });
+
+        processor.qualityTier = savedTier;
+
+        // The whole post-safety stage on a stereo block: level follower, gain glide and shaper.
+        // The copy back to the test signal is part of each pass; ns/sample counts both channels.
+        {
+            const auto channels = processor.getTotalNumInputChannels();
+            juce::AudioBuffer<float> block(channels, n);
+
+            report(options, "applyPostSafety", "stereo", n * channels, [&]
+            {
+                for (int ch = 0; ch < channels; ++ch)
+                    block.copyFrom(ch, 0, in, n);
+                processor.applyPostSafety(block);
+                sink = sink + block.getSample(0, n / 2);
+            });
+        }
+
+        // History reads at the sizes the stutter and skip engines use (2.5 s at 48 kHz), at a
+        // transposed rate so positions are fractional and walk across the packed blocks.
+       #if DIGITALIS_COMPACT_HISTORY
+        const auto* storage = "compact";
+       #else
+        const auto* storage = "float";
+       #endif
+        HistoryBuffer history;
+        history.setSize(120000);
+        for (int i = 0; i < history.size(); ++i)
+            history.write(i, in[(size_t) (i % n)]);
+
+        const auto length = static_cast<float>(history.size());
+        const auto* kernels = processor.sharedTables->sincKernels.data();
+        auto readPosition = 0.0f;
+        const auto nextPosition = [&]
+        {
+            readPosition += 0.7491f;
+            if (readPosition >= length)
+                readPosition -= length;
+            return readPosition;
+        };
+
+        report(options, "HistoryBuffer::write", storage, n, [&]
+        {
+            const auto base = static_cast<int>(nextPosition()) & ~31;
+            for (int i = 0; i < n; ++i)
+                history.write((base + i) % history.size(), in[i]);
+        });
+
+        report(options, "HistoryBuffer::read", storage, n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = history.read(static_cast<int>(nextPosition()));
+            settle();
+        });
+
+        report(options, "HistoryBuffer::readInterp", storage, n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = history.readInterpolated(nextPosition());
+            settle();
+        });
+
+        report(options, "HistoryBuffer::readSinc", storage, n, [&]
+        {
+            for (int i = 0; i < n; ++i)
+                out[i] = history.readSinc(nextPosition(), kernels);
+            settle();
+        });
+    }
+};
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const juce::String flag(argv[i]);
+        const juce::String value(argv[i + 1]);
+
+        if (flag == "--cpu")
+            options.cpu = juce::jlimit(0, 31, value.getIntValue());
+        else if (flag == "--reps")
+            options.repetitions = juce::jlimit(3, 1001, value.getIntValue());
+        else if (flag == "--samples")
+            options.samples = juce::jlimit(64, 1 << 20, value.getIntValue());
+        else if (flag == "--only")
+            options.only = value;
+        else if (flag == "--isa")
+            options.isa = value;
+        else
+        {
+            std::cerr << "unknown option " << flag << "\n";
+            return 1;
+        }
+    }
+
+    // Pin to one core so frequency and cache state do not change under a run. Not every platform
+    // honours this (macOS has no hard affinity); the figures are still valid, just noisier.
+    juce::Thread::setCurrentThreadAffinityMask(1u << (juce::uint32) options.cpu);
+
+    if (options.isa.isNotEmpty() && ! digitalis::forceKernels(options.isa))
+    {
+        std::cerr << "kernel variant " << options.isa << " is unknown or not supported here; available:";
+        for (const auto* table : digitalis::availableKernels())
+            std::cerr << " " << table->name;
+        std::cerr << "\n";
+        return 1;
+    }
+
+    std::unique_ptr<juce::AudioProcessor> plugin(createPluginFilter());
+    auto* processor = dynamic_cast<DigitalisAudioProcessor*>(plugin.get());
+    if (processor == nullptr)
+    {
+        std::cerr << "plugin is not a DigitalisAudioProcessor\n";
+        return 1;
+    }
+
+    processor->setPlayConfigDetails(2, 2, 48000.0, options.samples);
+    processor->prepareToPlay(48000.0, options.samples);
+
+    std::cout << processor->getName() << "\n";
+    std::cout << "CPU=" << options.cpu << "\n";
+    std::cout << "Repetitions=" << options.repetitions << "\n";
+    std::cout << "Samples=" << options.samples << "\n";
+    std::cout << "Kernels=" << digitalis::kernels().name << "\n";
+
+    KernelBench::run(*processor, options);
+    return 0;
+}
@@ -1,11 +1,16 @@
-#include <juce_audio_utils/juce_audio_utils.h>
-#include <juce_dsp/juce_dsp.h>
+#include "../Source/DigitalisDsp.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <iostream>
+#include <numbers>
+#include <random>
+#include <string>
 
-juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
-
+// Level and cost figures for one engine, driven through the plain digitalis_dsp API only, as an
+// embedding host would. DIGITALIS_MEASURE_ENGINE is the engine's index (see digitalis::dsp::EngineId).
 namespace
 {
 float dbToGain(float db)
@@ -15,44 +20,80 @@ float dbToGain(float db)
 
 float toDb(float x)
 {
-    return 20.0f * std::log10(juce::jmax(1.0e-9f, x));
+    return 20.0f * std::log10(std::max(1.0e-9f, x));
 }
+
+std::unique_ptr<digitalis::dsp::Engine> createEngine()
+{
+    return digitalis::dsp::Engine::create(static_cast<digitalis::dsp::EngineId>(DIGITALIS_MEASURE_ENGINE));
 }
+} // namespace
 
 int main(int argc, char** argv)
 {
-    const bool dryRun = (argc > 1 && juce::String(argv[1]) == "--dry");
-    const bool noProgram = (argc > 1 && juce::String(argv[1]) == "--no-program");
-    const bool prepareOnly = (argc > 1 && juce::String(argv[1]) == "--prepare-only");
+    const std::string flag = argc > 1 ? argv[1] : "";
+    const bool dryRun = flag == "--dry";
+    const bool noProgram = flag == "--no-program";
+    const bool prepareOnly = flag == "--prepare-only";
+    const bool customBlock = argc > 2 && flag == "--block";
+    const bool constructOnly = flag == "--construct";
 
     constexpr double sampleRate = 48000.0;
-    constexpr int blockSize = 256;
+    const int blockSize = customBlock ? std::clamp(std::atoi(argv[2]), 1, 8192) : 256;
     constexpr int channels = 2;
     constexpr float durationSec = 10.0f;
     const int totalSamples = static_cast<int>(durationSec * static_cast<float>(sampleRate));
 
-    std::unique_ptr<juce::AudioProcessor> proc(createPluginFilter());
+    // Hosts construct plugins in bulk during scans and session loads, so creation cost is reported
+    // on its own. --construct [n] times n create/destroy cycles and exits. One instance stays alive
+    // throughout, as it would in a host, so process-wide resources (the JUCE timer thread, shared
+    // DSP tables) are not rebuilt on every cycle.
+    if (constructOnly)
+    {
+        const int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 1000;
+        const auto engine = createEngine();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            createEngine();
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << engine->getName() << " (construct)\n";
+        std::cout << "Iterations=" << iterations << "\n";
+        std::cout << "Construct_us=" << elapsed.count() / iterations << "\n";
+        return 0;
+    }
+
+    const auto constructStart = std::chrono::steady_clock::now();
+    const auto engine = createEngine();
+    const std::chrono::duration<double, std::micro> constructTime = std::chrono::steady_clock::now() - constructStart;
     if (dryRun)
     {
-        std::cout << proc->getName() << " (dry)\n";
+        std::cout << engine->getName() << " (dry)\n";
         return 0;
     }
-    proc->prepareToPlay(sampleRate, blockSize);
+    engine->prepare(sampleRate, blockSize, channels);
     if (prepareOnly)
     {
-        std::cout << proc->getName() << " (prepare-only)\n";
+        std::cout << engine->getName() << " (prepare-only)\n";
         return 0;
     }
     if (!noProgram)
-        proc->setCurrentProgram(0); // Init default
+        engine->loadPreset(0); // Init default
+
+    std::vector<float> left((size_t) blockSize), right((size_t) blockSize);
+    std::vector<float> dryLeft((size_t) blockSize), dryRight((size_t) blockSize);
+    float* const block[] = { left.data(), right.data() };
+    const float* const dryBlock[] = { dryLeft.data(), dryRight.data() };
 
-    juce::AudioBuffer<float> block(channels, blockSize);
-    juce::MidiBuffer midi;
+    std::minstd_rand rng(std::random_device {}());
+    std::uniform_real_distribution<float> bipolar(-1.0f, 1.0f);
+    constexpr double twoPi = 2.0 * std::numbers::pi;
 
     double phaseA = 0.0;
     double phaseB = 0.0;
-    const double incA = juce::MathConstants<double>::twoPi * 97.0 / sampleRate;
-    const double incB = juce::MathConstants<double>::twoPi * 1880.0 / sampleRate;
+    const double incA = twoPi * 97.0 / sampleRate;
+    const double incB = twoPi * 1880.0 / sampleRate;
 
     double inSq = 0.0;
     double outSq = 0.0;
@@ -61,8 +102,7 @@ int main(int argc, char** argv)
     int processed = 0;
     while (processed < totalSamples)
     {
-        const int ns = juce::jmin(blockSize, totalSamples - processed);
-        block.clear();
+        const int ns = std::min(blockSize, totalSamples - processed);
 
         for (int i = 0; i < ns; ++i)
         {
@@ -71,27 +111,26 @@ int main(int argc, char** argv)
 
             const float sineLow = static_cast<float>(std::sin(phaseA)) * dbToGain(-14.0f);
             const float sineHigh = static_cast<float>(std::sin(phaseB)) * dbToGain(-21.0f);
-            const float noise = (juce::Random::getSystemRandom().nextFloat() * 2.0f - 1.0f) * dbToGain(-31.0f);
-            const float burst = burstEnv * (juce::Random::getSystemRandom().nextFloat() * 2.0f - 1.0f) * dbToGain(-9.0f);
+            const float noise = bipolar(rng) * dbToGain(-31.0f);
+            const float burst = burstEnv * bipolar(rng) * dbToGain(-9.0f);
 
             phaseA += incA;
             phaseB += incB;
-            if (phaseA > juce::MathConstants<double>::twoPi) phaseA -= juce::MathConstants<double>::twoPi;
-            if (phaseB > juce::MathConstants<double>::twoPi) phaseB -= juce::MathConstants<double>::twoPi;
+            if (phaseA > twoPi) phaseA -= twoPi;
+            if (phaseB > twoPi) phaseB -= twoPi;
 
-            const float l = juce::jlimit(-1.0f, 1.0f, sineLow + sineHigh + noise + burst);
-            const float r = juce::jlimit(-1.0f, 1.0f, sineLow * 0.92f + sineHigh * 1.06f + noise * 1.04f + burst * 0.95f);
-            block.setSample(0, i, l);
-            block.setSample(1, i, r);
+            const float l = std::clamp(sineLow + sineHigh + noise + burst, -1.0f, 1.0f);
+            const float r = std::clamp(sineLow * 0.92f + sineHigh * 1.06f + noise * 1.04f + burst * 0.95f, -1.0f, 1.0f);
+            left[(size_t) i] = dryLeft[(size_t) i] = l;
+            right[(size_t) i] = dryRight[(size_t) i] = r;
         }
 
-        juce::AudioBuffer<float> dryBuffer(block);
-        proc->processBlock(block, midi);
+        engine->process(block, channels, ns);
 
         for (int ch = 0; ch < channels; ++ch)
         {
-            const auto* in = dryBuffer.getReadPointer(ch);
-            const auto* out = block.getReadPointer(ch);
+            const auto* in = dryBlock[ch];
+            const auto* out = block[ch];
             for (int i = 0; i < ns; ++i)
             {
                 inSq += in[i] * in[i];
@@ -103,11 +142,13 @@ int main(int argc, char** argv)
         processed += ns;
     }
 
-    const float inRms = static_cast<float>(std::sqrt(inSq / static_cast<double>(juce::jmax(1, n))));
-    const float outRms = static_cast<float>(std::sqrt(outSq / static_cast<double>(juce::jmax(1, n))));
+    const float inRms = static_cast<float>(std::sqrt(inSq / static_cast<double>(std::max(1, n))));
+    const float outRms = static_cast<float>(std::sqrt(outSq / static_cast<double>(std::max(1, n))));
     const float delta = toDb(outRms) - toDb(inRms);
 
-    std::cout << proc->getName() << "\n";
+    std::cout << engine->getName() << "\n";
+    std::cout << "BlockSize=" << blockSize << "\n";
+    std::cout << "Construct_us=" << constructTime.count() << "\n";
     std::cout << "InputRMS_dB=" << toDb(inRms) << "\n";
     std::cout << "OutputRMS_dB=" << toDb(outRms) << "\n";
     std::cout << "Delta_dB=" << delta << "\n";
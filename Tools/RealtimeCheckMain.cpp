@@ -0,0 +1,353 @@
+#include <juce_audio_utils/juce_audio_utils.h>
+#include "../Source/RealtimeScope.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <poll.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#include <unistd.h>
+
+#if ! DIGITALIS_RT_SANITIZER
+ #error "RealtimeCheck needs a plugin built with DIGITALIS_RT_SANITIZER"
+#endif
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+// Realtime-safety check for processBlock and reset() (Linux, glibc). Sanitizer builds open a
+// digitalis::RealtimeScope for the duration of each; this executable interposes the C
+// allocator, mutex and rwlock locking and the common blocking calls, and reports every call made
+// while a scope is open on the calling thread, with a stack trace. operator new and delete reach
+// malloc and free, so they are caught there. Condition waits need a held mutex, so the lock that
+// precedes one is reported instead.
+//
+// The driver runs every factory preset, then sweeps each parameter through five values, processing
+// blocks of several sizes at each step. Parameters are changed between blocks, as a host does from
+// its own thread, and the Limiter switch is flipped between every pair of blocks. Halfway through
+// each run of blocks it calls reset(), as the VST3 wrapper does on setProcessing(false). A listener
+// is attached as a host's would be, so callbacks into the host from the audio thread, and the locks
+// they take, are caught too. It exits with 1 on any violation, so the post-build step fails the build.
+//
+//   RealtimeCheck<Plugin> [--verbose]
+namespace
+{
+std::atomic<int> violations { 0 };
+std::atomic<int> tracesPrinted { 0 };
+constexpr int maxTraces = 20;
+
+// What the driver is doing, for the report. Written only between blocks.
+char context[256] = "startup";
+
+thread_local bool reporting = false;
+
+void flagViolation(const char* call)
+{
+    if (! digitalis::RealtimeScope::isActive() || reporting)
+        return;
+
+    reporting = true;
+    violations.fetch_add(1);
+
+    if (tracesPrinted.fetch_add(1) < maxTraces)
+    {
+        std::fprintf(stderr, "realtime violation: %s on the audio thread (%s)\n", call, context);
+        void* frames[48];
+        const auto depth = backtrace(frames, 48);
+        backtrace_symbols_fd(frames + 1, depth - 1, STDERR_FILENO);
+        std::fprintf(stderr, "\n");
+    }
+
+    reporting = false;
+}
+
+template <typename Fn>
+Fn next(Fn& slot, const char* name)
+{
+    if (slot == nullptr)
+        slot = reinterpret_cast<Fn>(dlsym(RTLD_NEXT, name));
+    return slot;
+}
+} // namespace
+
+// glibc exports its allocator under these names too, which lets the wrappers below forward without
+// dlsym (which itself allocates).
+extern "C"
+{
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void __libc_free(void*);
+
+void* malloc(size_t size)
+{
+    flagViolation("malloc");
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size)
+{
+    flagViolation("calloc");
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size)
+{
+    flagViolation("realloc");
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size)
+{
+    flagViolation("memalign");
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size)
+{
+    flagViolation("aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size)
+{
+    flagViolation("posix_memalign");
+    *result = __libc_memalign(alignment, size);
+    return *result != nullptr || size == 0 ? 0 : ENOMEM;
+}
+
+void free(void* ptr)
+{
+    if (ptr != nullptr)
+        flagViolation("free");
+    __libc_free(ptr);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex)
+{
+    static int (*real)(pthread_mutex_t*) = nullptr;
+    flagViolation("pthread_mutex_lock");
+    return next(real, "pthread_mutex_lock")(mutex);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t* lock)
+{
+    static int (*real)(pthread_rwlock_t*) = nullptr;
+    flagViolation("pthread_rwlock_rdlock");
+    return next(real, "pthread_rwlock_rdlock")(lock);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t* lock)
+{
+    static int (*real)(pthread_rwlock_t*) = nullptr;
+    flagViolation("pthread_rwlock_wrlock");
+    return next(real, "pthread_rwlock_wrlock")(lock);
+}
+
+int pthread_join(pthread_t thread, void** result)
+{
+    static int (*real)(pthread_t, void**) = nullptr;
+    flagViolation("pthread_join");
+    return next(real, "pthread_join")(thread, result);
+}
+
+int sem_wait(sem_t* sem)
+{
+    static int (*real)(sem_t*) = nullptr;
+    flagViolation("sem_wait");
+    return next(real, "sem_wait")(sem);
+}
+
+int nanosleep(const struct timespec* duration, struct timespec* remaining)
+{
+    static int (*real)(const struct timespec*, struct timespec*) = nullptr;
+    flagViolation("nanosleep");
+    return next(real, "nanosleep")(duration, remaining);
+}
+
+int clock_nanosleep(clockid_t clock, int flags, const struct timespec* duration, struct timespec* remaining)
+{
+    static int (*real)(clockid_t, int, const struct timespec*, struct timespec*) = nullptr;
+    flagViolation("clock_nanosleep");
+    return next(real, "clock_nanosleep")(clock, flags, duration, remaining);
+}
+
+int usleep(useconds_t micros)
+{
+    static int (*real)(useconds_t) = nullptr;
+    flagViolation("usleep");
+    return next(real, "usleep")(micros);
+}
+
+ssize_t read(int fd, void* data, size_t size)
+{
+    static ssize_t (*real)(int, void*, size_t) = nullptr;
+    flagViolation("read");
+    return next(real, "read")(fd, data, size);
+}
+
+ssize_t write(int fd, const void* data, size_t size)
+{
+    static ssize_t (*real)(int, const void*, size_t) = nullptr;
+    flagViolation("write");
+    return next(real, "write")(fd, data, size);
+}
+
+int poll(struct pollfd* fds, nfds_t count, int timeout)
+{
+    static int (*real)(struct pollfd*, nfds_t, int) = nullptr;
+    flagViolation("poll");
+    return next(real, "poll")(fds, count, timeout);
+}
+
+int fsync(int fd)
+{
+    static int (*real)(int) = nullptr;
+    flagViolation("fsync");
+    return next(real, "fsync")(fd);
+}
+}
+
+namespace
+{
+constexpr double sampleRate = 48000.0;
+constexpr int channels = 2;
+constexpr int maxBlockSize = 512;
+
+// Odd and tiny sizes as well as full blocks, since chunking code tends to allocate at the edges.
+constexpr int blockSizes[] = { maxBlockSize, 1, 37, 256, 64, maxBlockSize };
+
+// Stands in for the plugin wrapper's listener. It only counts, so any violation reported under one
+// of its callbacks comes from the plugin calling out from the audio thread, not from the listener.
+class HostListener : public juce::AudioProcessorListener
+{
+public:
+    void audioProcessorParameterChanged(juce::AudioProcessor*, int, float) override { ++parameterChanges; }
+    void audioProcessorChanged(juce::AudioProcessor*, const ChangeDetails&) override { ++processorChanges; }
+
+    std::atomic<int> parameterChanges { 0 };
+    std::atomic<int> processorChanges { 0 };
+};
+
+class Driver
+{
+public:
+    explicit Driver(juce::AudioProcessor& p) : proc(p), block(channels, maxBlockSize)
+    {
+        for (auto* parameter : proc.getParameters())
+            if (auto* withId = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter); withId != nullptr && withId->paramID == "limiter")
+                limiter = parameter;
+    }
+
+    void runBlocks()
+    {
+        for (size_t b = 0; b < std::size(blockSizes); ++b)
+        {
+            const auto size = blockSizes[b];
+            block.setSize(channels, size, false, false, true);
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                auto* write = block.getWritePointer(ch);
+                for (int i = 0; i < size; ++i)
+                    write[i] = 0.3f * std::sin(0.013f * static_cast<float>(sampleClock + i))
+                             + 0.1f * (rng.nextFloat() * 2.0f - 1.0f);
+            }
+
+            proc.processBlock(block, midi);
+            sampleClock = (sampleClock + size) & 0xffffff;
+
+            if (b == std::size(blockSizes) / 2)
+                proc.reset();
+
+            // blockSizes has an even count, so a run ends with the switch where the sweep left it.
+            if (limiter != nullptr)
+                limiter->setValueNotifyingHost(1.0f - limiter->getValue());
+        }
+    }
+
+private:
+    juce::AudioProcessor& proc;
+    juce::AudioProcessorParameter* limiter = nullptr;
+    juce::AudioBuffer<float> block;
+    juce::MidiBuffer midi;
+    juce::Random rng { 0x7ea1 };
+    int sampleClock = 0;
+};
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const auto verbose = argc > 1 && juce::String(argv[1]) == "--verbose";
+
+    // backtrace() loads its unwinder on first use; do that now rather than inside a report.
+    void* warmup[4];
+    backtrace(warmup, 4);
+
+    // Self-test: the interposers must be live, or a clean run proves nothing.
+    tracesPrinted = maxTraces;
+    {
+        const digitalis::RealtimeScope scope;
+        void* volatile probe = std::malloc(16);
+        std::free(probe);
+    }
+
+    if (violations.load() < 2)
+    {
+        std::fprintf(stderr, "allocator interposition is not active\n");
+        return 1;
+    }
+
+    violations = 0;
+    tracesPrinted = 0;
+
+    std::unique_ptr<juce::AudioProcessor> proc(createPluginFilter());
+    proc->setPlayConfigDetails(channels, channels, sampleRate, maxBlockSize);
+    proc->setNonRealtime(false);
+
+    HostListener listener;
+    proc->addListener(&listener);
+
+    Driver driver(*proc);
+    auto& parameters = proc->getParameters();
+
+    for (int p = 0; p < proc->getNumPrograms(); ++p)
+    {
+        const auto presetName = proc->getProgramName(p);
+        proc->setCurrentProgram(p);
+        proc->prepareToPlay(sampleRate, maxBlockSize);
+
+        std::snprintf(context, sizeof(context), "preset '%s'", presetName.toRawUTF8());
+        driver.runBlocks();
+
+        for (auto* parameter : parameters)
+        {
+            const auto original = parameter->getValue();
+            const auto name = parameter->getName(64);
+
+            for (const auto value : { 0.0f, 0.25f, 0.5f, 0.75f, 1.0f })
+            {
+                parameter->setValueNotifyingHost(value);
+                std::snprintf(context, sizeof(context), "preset '%s', %s = %.2f",
+                              presetName.toRawUTF8(), name.toRawUTF8(), value);
+                driver.runBlocks();
+            }
+
+            parameter->setValueNotifyingHost(original);
+        }
+
+        if (verbose)
+            std::printf("%s: %d violations so far\n", presetName.toRawUTF8(), violations.load());
+    }
+
+    proc->removeListener(&listener);
+
+    std::printf("%s: %d realtime violations\n", proc->getName().toRawUTF8(), violations.load());
+    return violations.load() > 0 ? 1 : 0;
+}
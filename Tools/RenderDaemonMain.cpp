@@ -0,0 +1,293 @@
+#include <juce_audio_utils/juce_audio_utils.h>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+// Long-running offline renderer for one Digitalis engine. Each engine is its own compile-time
+// target, so there is one daemon per engine and a batch driver routes jobs by engine name.
+//
+// Jobs arrive one per line on stdin (a pipe from the driver, or a FIFO), tab separated:
+//
+//     <engine> \t <input file> \t <output file> [\t <base64 state>]
+//
+// The state is what getStateInformation() writes, base64 encoded; without one the Init program is
+// used. Replies go to stdout, one line per job, in completion order:
+//
+//     ok \t <output file> \t <samples> \t <ms>
+//     error \t <output file> \t <message>
+//
+// "ping" answers "pong"; "quit" or end of input drains the queue and exits.
+//
+// Instances are constructed and prepared up front for the common sample rates and handed back to
+// the pool after each job. Reuse only costs a state recall and reset(), so short files are no
+// longer dominated by construction, prepareToPlay allocation and preset application.
+namespace
+{
+constexpr int renderBlockSize = 512;
+constexpr int renderChannels = 2;
+
+class ProcessorPool
+{
+public:
+    void warm(double sampleRate, int count)
+    {
+        for (int i = 0; i < count; ++i)
+            release(sampleRate, create(sampleRate));
+    }
+
+    std::unique_ptr<juce::AudioProcessor> acquire(double sampleRate)
+    {
+        {
+            const std::scoped_lock lock(mutex);
+            auto& idle = pools[sampleRate];
+
+            if (! idle.empty())
+            {
+                auto proc = std::move(idle.back());
+                idle.pop_back();
+                return proc;
+            }
+        }
+
+        // Uncommon rate, or every warm instance is busy: build one now and keep it afterwards.
+        return create(sampleRate);
+    }
+
+    void release(double sampleRate, std::unique_ptr<juce::AudioProcessor> proc)
+    {
+        const std::scoped_lock lock(mutex);
+        pools[sampleRate].push_back(std::move(proc));
+    }
+
+private:
+    static std::unique_ptr<juce::AudioProcessor> create(double sampleRate)
+    {
+        std::unique_ptr<juce::AudioProcessor> proc(createPluginFilter());
+        proc->setPlayConfigDetails(renderChannels, renderChannels, sampleRate, renderBlockSize);
+        proc->setNonRealtime(true);
+        proc->prepareToPlay(sampleRate, renderBlockSize);
+        return proc;
+    }
+
+    std::mutex mutex;
+    std::map<double, std::vector<std::unique_ptr<juce::AudioProcessor>>> pools;
+};
+
+struct RenderJob
+{
+    juce::File input;
+    juce::File output;
+    juce::String state;
+};
+
+class RenderDaemon
+{
+public:
+    RenderDaemon(int numWorkers, const juce::Array<double>& warmRates)
+        : workers(numWorkers)
+    {
+        formats.registerBasicFormats();
+
+        for (const auto rate : warmRates)
+            pool.warm(rate, numWorkers);
+
+        std::unique_ptr<juce::AudioProcessor> probe(createPluginFilter());
+        engineName = probe->getName();
+    }
+
+    const juce::String& getEngineName() const { return engineName; }
+
+    void submit(const juce::String& line)
+    {
+        const auto fields = juce::StringArray::fromTokens(line, "\t", {});
+
+        if (fields.size() < 3)
+        {
+            reply("error\t\texpected <engine> <input> <output> [state]");
+            return;
+        }
+
+        if (fields[0] != engineName)
+        {
+            reply("error\t" + fields[2] + "\tthis daemon renders " + engineName);
+            return;
+        }
+
+        RenderJob job { juce::File(fields[1]), juce::File(fields[2]), fields[3] };
+        workers.addJob([this, job] { run(job); });
+    }
+
+    void reply(const juce::String& line)
+    {
+        const std::scoped_lock lock(replyMutex);
+        std::cout << line << std::endl;
+    }
+
+    void drain()
+    {
+        while (workers.getNumJobs() > 0)
+            juce::Thread::sleep(1);
+    }
+
+private:
+    void run(const RenderJob& job)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        juce::String error;
+        const auto samples = render(job, error);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (error.isNotEmpty())
+            reply("error\t" + job.output.getFullPathName() + "\t" + error);
+        else
+            reply("ok\t" + job.output.getFullPathName() + "\t" + juce::String(samples) + "\t" + juce::String(elapsed.count(), 2));
+    }
+
+    juce::int64 render(const RenderJob& job, juce::String& error)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(job.input));
+        if (reader == nullptr)
+        {
+            error = "cannot read " + job.input.getFullPathName();
+            return 0;
+        }
+
+        const auto fileChannels = static_cast<int>(reader->numChannels);
+        if (fileChannels < 1 || fileChannels > renderChannels)
+        {
+            error = "only mono and stereo files are supported";
+            return 0;
+        }
+
+        auto* format = formats.findFormatForFileExtension(job.output.getFileExtension());
+        if (format == nullptr)
+        {
+            error = "unknown output format " + job.output.getFileExtension();
+            return 0;
+        }
+
+        job.output.deleteFile();
+        std::unique_ptr<juce::OutputStream> stream = std::make_unique<juce::FileOutputStream>(job.output);
+        if (! static_cast<juce::FileOutputStream&>(*stream).openedOk())
+        {
+            error = "cannot write " + job.output.getFullPathName();
+            return 0;
+        }
+
+        auto writer = format->createWriterFor(stream, juce::AudioFormatWriterOptions {}
+                                                          .withSampleRate(reader->sampleRate)
+                                                          .withNumChannels(fileChannels)
+                                                          .withBitsPerSample(juce::jmax(16, static_cast<int>(reader->bitsPerSample))));
+        if (writer == nullptr)
+        {
+            error = "cannot create a writer for " + job.output.getFileName();
+            return 0;
+        }
+
+        const auto sampleRate = reader->sampleRate;
+        auto proc = pool.acquire(sampleRate);
+
+        // A warm instance carries the previous job's parameters and DSP state; both are replaced.
+        // Init goes first so parameters missing from an older state blob don't leak between jobs.
+        proc->setCurrentProgram(0);
+
+        juce::MemoryBlock state;
+        if (job.state.isNotEmpty() && state.fromBase64Encoding(job.state))
+            proc->setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+
+        proc->reset();
+
+        // The output is aligned with the input: the reported latency is skipped at the start and
+        // flushed with silence at the end.
+        const auto latency = static_cast<juce::int64>(proc->getLatencySamples());
+        const auto length = reader->lengthInSamples;
+        juce::AudioBuffer<float> block(renderChannels, renderBlockSize);
+        juce::MidiBuffer midi;
+        juce::int64 written = 0;
+
+        for (juce::int64 pos = 0; written < length; pos += renderBlockSize)
+        {
+            block.clear();
+            const auto toRead = static_cast<int>(juce::jlimit<juce::int64>(0, renderBlockSize, length - pos));
+
+            if (toRead > 0)
+                reader->read(&block, 0, toRead, pos, true, fileChannels > 1);
+
+            if (fileChannels == 1)
+                block.copyFrom(1, 0, block, 0, 0, renderBlockSize);
+
+            proc->processBlock(block, midi);
+
+            const auto skip = static_cast<int>(juce::jlimit<juce::int64>(0, renderBlockSize, latency - pos));
+            const auto count = static_cast<int>(juce::jmin(static_cast<juce::int64>(renderBlockSize - skip), length - written));
+
+            if (count > 0)
+            {
+                writer->writeFromAudioSampleBuffer(block, skip, count);
+                written += count;
+            }
+        }
+
+        pool.release(sampleRate, std::move(proc));
+        return written;
+    }
+
+    juce::AudioFormatManager formats;
+    ProcessorPool pool;
+    juce::ThreadPool workers;
+    std::mutex replyMutex;
+    juce::String engineName;
+};
+}
+
+int main(int argc, char** argv)
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    int numWorkers = juce::jmax(1, juce::SystemStats::getNumCpus());
+    juce::Array<double> warmRates { 44100.0, 48000.0 };
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const juce::String option(argv[i]);
+        const juce::String value(argv[i + 1]);
+
+        if (option == "--workers")
+        {
+            numWorkers = juce::jlimit(1, 64, value.getIntValue());
+        }
+        else if (option == "--rates")
+        {
+            warmRates.clear();
+            for (const auto& rate : juce::StringArray::fromTokens(value, ",", {}))
+                if (rate.getDoubleValue() > 0.0)
+                    warmRates.add(rate.getDoubleValue());
+        }
+    }
+
+    RenderDaemon daemon(numWorkers, warmRates);
+    daemon.reply("ready\t" + daemon.getEngineName() + "\t" + juce::String(numWorkers));
+
+    for (std::string line; std::getline(std::cin, line);)
+    {
+        const auto command = juce::String(line).trimCharactersAtEnd("\r\n");
+
+        if (command.isEmpty())
+            continue;
+
+        if (command == "quit")
+            break;
+
+        if (command == "ping")
+            daemon.reply("pong");
+        else
+            daemon.submit(command);
+    }
+
+    daemon.drain();
+    return 0;
+}
@@ -0,0 +1,308 @@
+#include <juce_audio_utils/juce_audio_utils.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+// Feeds the plugin inputs that real sessions produce only occasionally and that DSP code tends to
+// handle badly: silence, DC, full-scale square waves, sparse impulses (long decays into the
+// denormal range), noise made entirely of denormals, and a burst of NaN and Inf in otherwise clean
+// programme. Every factory preset runs every case from a freshly prepared instance.
+//
+// For each run it reports the median and worst block time, the worst block as a share of its
+// real-time budget, and the median relative to the programme case on the same preset, which is
+// where a denormal slowdown shows. It also counts non-finite output samples, which the plugin should
+// never produce: it drops NaN and Inf at its input.
+//
+// The NaN/Inf case also checks that nothing was left poisoned. Once the input has been clean for
+// longer than any engine remembers, the output must not sit on a DC offset. And after the input
+// falls silent, and stays so for longer than the reported tail, the output must be silent too.
+//
+// The exit code is 1 if any run produced non-finite output, failed to recover from the NaN/Inf
+// burst, slowed down by more than --max-slowdown, or overran its block budget. Builds configured with
+// DIGITALIS_FLUSH_DENORMALS=OFF leave the FPU in its default mode during processBlock, which shows
+// what the engines cost on hosts or CPUs where flush-to-zero does not take effect.
+//
+//   Stress<Plugin> [--block n] [--preset n] [--offline] [--max-slowdown x]
+namespace
+{
+constexpr double sampleRate = 48000.0;
+constexpr int channels = 2;
+constexpr double durationSec = 8.0;
+
+// The NaN/Inf burst, where its recovery window starts (past the longest engine memory, 2.5 s of
+// skip history), and where the input goes silent for the rest of the run.
+constexpr double burstStartSec = 1.0;
+constexpr double burstLengthSec = 0.01;
+constexpr double recoveredSec = 3.6;
+constexpr double silenceSec = 5.0;
+
+// Recovery limits: a mean offset above -26 dBFS on zero-mean programme, and a level above -80 dBFS
+// at the end of the silence.
+constexpr double maxRecoveredOffset = 0.05;
+constexpr float maxSilentPeak = 1.0e-4f;
+constexpr double silentPeakWindowSec = 0.5;
+
+enum class Case
+{
+    programme,
+    silence,
+    dc,
+    square,
+    impulses,
+    denormalNoise,
+    nonFinite
+};
+
+constexpr Case allCases[] = { Case::programme, Case::silence, Case::dc, Case::square,
+                              Case::impulses, Case::denormalNoise, Case::nonFinite };
+
+const char* caseName(Case c)
+{
+    switch (c)
+    {
+        case Case::programme: return "programme";
+        case Case::silence: return "silence";
+        case Case::dc: return "dc";
+        case Case::square: return "square";
+        case Case::impulses: return "impulses";
+        case Case::denormalNoise: return "denormal-noise";
+        case Case::nonFinite: return "nan-inf";
+    }
+    return "";
+}
+
+// Deterministic per-case input, so runs on different machines see the same samples.
+class InputGenerator
+{
+public:
+    explicit InputGenerator(Case c) : kind(c), rng(0x57e55 + static_cast<int>(c)) {}
+
+    float next(int64_t sample, int channel)
+    {
+        const auto t = static_cast<double>(sample) / sampleRate;
+
+        switch (kind)
+        {
+            case Case::silence:
+                return 0.0f;
+            case Case::dc:
+                return channel == 0 ? 0.5f : 0.45f;
+            case Case::square:
+                return std::fmod(t * 110.0, 1.0) < 0.5 ? 1.0f : -1.0f;
+            case Case::impulses:
+                return sample % (int64_t) (sampleRate / 2) == 0 ? 1.0f : 0.0f;
+            case Case::denormalNoise:
+            {
+                // Random mantissa, zero exponent: every sample is subnormal or zero.
+                const auto sign = rng.nextBool() ? 0x80000000u : 0u;
+                return std::bit_cast<float>(sign | (static_cast<std::uint32_t>(rng.nextInt()) & 0x007fffffu));
+            }
+            case Case::nonFinite:
+                if (t >= burstStartSec && t < burstStartSec + burstLengthSec)
+                {
+                    switch (sample % 3)
+                    {
+                        case 0: return std::numeric_limits<float>::quiet_NaN();
+                        case 1: return std::numeric_limits<float>::infinity();
+                        default: return -std::numeric_limits<float>::infinity();
+                    }
+                }
+                return t < silenceSec ? programme(t, channel) : 0.0f;
+            case Case::programme:
+                return programme(t, channel);
+        }
+        return 0.0f;
+    }
+
+private:
+    float programme(double t, int channel)
+    {
+        const auto twoPi = juce::MathConstants<double>::twoPi;
+        const auto low = 0.2f * static_cast<float>(std::sin(twoPi * 97.0 * t));
+        const auto high = 0.09f * static_cast<float>(std::sin(twoPi * 1880.0 * t));
+        const auto noise = 0.03f * (rng.nextFloat() * 2.0f - 1.0f);
+        const auto burst = std::fmod(t, 1.3) < 0.08 ? 0.35f * (rng.nextFloat() * 2.0f - 1.0f) : 0.0f;
+        return (low + high + noise + burst) * (channel == 0 ? 1.0f : 0.95f);
+    }
+
+    Case kind;
+    juce::Random rng;
+};
+
+struct RunResult
+{
+    double medianUs = 0.0;
+    double maxUs = 0.0;
+    double budgetUs = 0.0;
+    int64_t nonFinite = 0;
+    const char* recovery = "-"; // NaN/Inf case only: "ok", "dc" or "ringing"
+};
+
+RunResult runCase(juce::AudioProcessor& proc, Case c, int blockSize)
+{
+    proc.prepareToPlay(sampleRate, blockSize);
+
+    juce::AudioBuffer<float> block(channels, blockSize);
+    juce::MidiBuffer midi;
+    InputGenerator input(c);
+
+    const auto totalSamples = static_cast<int64_t>(durationSec * sampleRate);
+    const auto recoveredFrom = static_cast<int64_t>(recoveredSec * sampleRate);
+    const auto silentFrom = static_cast<int64_t>(silenceSec * sampleRate);
+    const auto silentPeakFrom = totalSamples - static_cast<int64_t>(silentPeakWindowSec * sampleRate);
+    double recoveredSum = 0.0;
+    int64_t recoveredCount = 0;
+    auto silentPeak = 0.0f;
+
+    std::vector<double> blockUs;
+    blockUs.reserve((size_t) (totalSamples / blockSize + 1));
+    RunResult result;
+
+    for (int64_t processed = 0; processed < totalSamples;)
+    {
+        const auto ns = static_cast<int>(std::min<int64_t>(blockSize, totalSamples - processed));
+        block.setSize(channels, ns, false, false, true);
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            auto* write = block.getWritePointer(ch);
+            for (int i = 0; i < ns; ++i)
+                write[i] = input.next(processed + i, ch);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        proc.processBlock(block, midi);
+        const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+
+        // Short final blocks would skew the per-block figures.
+        if (ns == blockSize)
+            blockUs.push_back(elapsed.count());
+
+        for (int ch = 0; ch < channels; ++ch)
+        {
+            const auto* read = block.getReadPointer(ch);
+            for (int i = 0; i < ns; ++i)
+            {
+                const auto sample = processed + i;
+                if (! std::isfinite(read[i]))
+                {
+                    ++result.nonFinite;
+                    continue;
+                }
+
+                if (sample >= recoveredFrom && sample < silentFrom)
+                {
+                    recoveredSum += read[i];
+                    ++recoveredCount;
+                }
+                else if (sample >= silentPeakFrom)
+                {
+                    silentPeak = std::max(silentPeak, std::abs(read[i]));
+                }
+            }
+        }
+
+        processed += ns;
+    }
+
+    if (c == Case::nonFinite)
+    {
+        // An engine that legitimately rings on past the silent stretch is only held to the DC check.
+        const auto silentSec = durationSec - silenceSec - silentPeakWindowSec;
+        const auto expectSilence = proc.getTailLengthSeconds() + proc.getLatencySamples() / sampleRate < silentSec;
+        const auto offset = recoveredCount > 0 ? std::abs(recoveredSum / static_cast<double>(recoveredCount)) : 0.0;
+
+        if (offset > maxRecoveredOffset)
+            result.recovery = "dc";
+        else if (expectSilence && silentPeak > maxSilentPeak)
+            result.recovery = "ringing";
+        else
+            result.recovery = "ok";
+    }
+
+    std::sort(blockUs.begin(), blockUs.end());
+    result.medianUs = blockUs.empty() ? 0.0 : blockUs[blockUs.size() / 2];
+    result.maxUs = blockUs.empty() ? 0.0 : blockUs.back();
+    result.budgetUs = 1.0e6 * blockSize / sampleRate;
+    return result;
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    auto blockSize = 256;
+    auto onlyPreset = -1;
+    auto offline = false;
+    auto maxSlowdown = 4.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const juce::String flag(argv[i]);
+        const auto hasValue = i + 1 < argc;
+
+        if (flag == "--offline")
+            offline = true;
+        else if (flag == "--block" && hasValue)
+            blockSize = juce::jlimit(16, 8192, juce::String(argv[++i]).getIntValue());
+        else if (flag == "--preset" && hasValue)
+            onlyPreset = juce::String(argv[++i]).getIntValue();
+        else if (flag == "--max-slowdown" && hasValue)
+            maxSlowdown = juce::jmax(1.0, juce::String(argv[++i]).getDoubleValue());
+        else
+        {
+            std::cerr << "unknown option " << flag << "\n";
+            return 1;
+        }
+    }
+
+    std::unique_ptr<juce::AudioProcessor> proc(createPluginFilter());
+    proc->setPlayConfigDetails(channels, channels, sampleRate, blockSize);
+    proc->setNonRealtime(offline);
+
+    std::cout << proc->getName() << "\n";
+    std::cout << "BlockSize=" << blockSize << "\n";
+    std::cout << "Offline=" << (offline ? 1 : 0) << "\n";
+    std::printf("%-24s %-15s %10s %10s %8s %9s %10s %9s\n",
+                "preset", "case", "median_us", "max_us", "max_%", "slowdown", "nonfinite", "recovery");
+
+    auto failed = false;
+
+    for (int p = 0; p < proc->getNumPrograms(); ++p)
+    {
+        if (onlyPreset >= 0 && p != onlyPreset)
+            continue;
+
+        proc->setCurrentProgram(p);
+        const auto presetName = proc->getProgramName(p);
+        auto referenceUs = 0.0;
+
+        for (const auto c : allCases)
+        {
+            const auto result = runCase(*proc, c, blockSize);
+            if (c == Case::programme)
+                referenceUs = result.medianUs;
+
+            const auto slowdown = referenceUs > 0.0 ? result.medianUs / referenceUs : 1.0;
+            const auto maxShare = 100.0 * result.maxUs / result.budgetUs;
+            const auto unrecovered = c == Case::nonFinite && std::strcmp(result.recovery, "ok") != 0;
+            const auto bad = result.nonFinite > 0 || unrecovered || slowdown > maxSlowdown || maxShare > 100.0;
+            failed = failed || bad;
+
+            std::printf("%-24s %-15s %10.1f %10.1f %8.1f %9.2f %10lld %9s%s\n",
+                        presetName.toRawUTF8(), caseName(c), result.medianUs, result.maxUs, maxShare,
+                        slowdown, (long long) result.nonFinite, result.recovery, bad ? "  FAIL" : "");
+            std::fflush(stdout);
+        }
+    }
+
+    return failed ? 1 : 0;
+}